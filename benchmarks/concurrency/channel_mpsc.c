@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: (MIT OR Apache-2.0)
+// C baseline: MPSC throughput — N sender threads, one receiver, 100k messages.
+
+#include <stdint.h>
+#include <pthread.h>
+
+extern void rask_bench_run(void (*fn)(void), const char *name);
+
+typedef struct RaskSender RaskSender;
+typedef struct RaskRecver RaskRecver;
+void        rask_channel_new(int64_t elem_size, int64_t capacity,
+                             RaskSender **tx_out, RaskRecver **rx_out);
+int64_t     rask_channel_send(RaskSender *tx, const void *data);
+int64_t     rask_channel_recv(RaskRecver *rx, void *data_out);
+RaskSender *rask_sender_clone(RaskSender *tx);
+void        rask_sender_drop(RaskSender *tx);
+void        rask_recver_drop(RaskRecver *rx);
+
+#define TOTAL 100000
+
+static int64_t nsenders;
+
+static void *sender(void *arg) {
+    RaskSender *tx = (RaskSender *)arg;
+    int64_t per = TOTAL / nsenders;
+    for (int64_t i = 0; i < per; i++) {
+        rask_channel_send(tx, &i);
+    }
+    rask_sender_drop(tx);
+    return 0;
+}
+
+static void work(void) {
+    RaskSender *tx;
+    RaskRecver *rx;
+    rask_channel_new(8, 1024, &tx, &rx);
+    pthread_t threads[8];
+    for (int64_t i = 0; i < nsenders; i++) {
+        pthread_create(&threads[i], 0, sender, rask_sender_clone(tx));
+    }
+    rask_sender_drop(tx);
+    int64_t v, received = 0;
+    while (rask_channel_recv(rx, &v) == 0) {
+        received++;
+    }
+    for (int64_t i = 0; i < nsenders; i++) {
+        pthread_join(threads[i], 0);
+    }
+    rask_recver_drop(rx);
+}
+
+int main(void) {
+    nsenders = 1;
+    rask_bench_run(work, "channel mpsc 1 sender 100k");
+    nsenders = 4;
+    rask_bench_run(work, "channel mpsc 4 senders 100k");
+    nsenders = 8;
+    rask_bench_run(work, "channel mpsc 8 senders 100k");
+    return 0;
+}
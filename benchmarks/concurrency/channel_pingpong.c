@@ -0,0 +1,46 @@
+// SPDX-License-Identifier: (MIT OR Apache-2.0)
+// C baseline: channel ping-pong — Rask channel runtime driven from pthreads.
+
+#include <stdint.h>
+#include <pthread.h>
+
+extern void rask_bench_run(void (*fn)(void), const char *name);
+
+typedef struct RaskSender RaskSender;
+typedef struct RaskRecver RaskRecver;
+void    rask_channel_new(int64_t elem_size, int64_t capacity,
+                         RaskSender **tx_out, RaskRecver **rx_out);
+int64_t rask_channel_send(RaskSender *tx, const void *data);
+int64_t rask_channel_recv(RaskRecver *rx, void *data_out);
+
+#define ROUNDS 1000
+
+static RaskSender *ping_tx, *pong_tx;
+static RaskRecver *ping_rx, *pong_rx;
+
+// Echoes forever; the benchmark fn drives ROUNDS round trips per iteration.
+static void *echoer(void *arg) {
+    (void)arg;
+    int64_t v;
+    while (rask_channel_recv(ping_rx, &v) == 0) {
+        rask_channel_send(pong_tx, &v);
+    }
+    return 0;
+}
+
+static void work(void) {
+    for (int64_t i = 0; i < ROUNDS; i++) {
+        rask_channel_send(ping_tx, &i);
+        int64_t v;
+        rask_channel_recv(pong_rx, &v);
+    }
+}
+
+int main(void) {
+    rask_channel_new(8, 1, &ping_tx, &ping_rx);
+    rask_channel_new(8, 1, &pong_tx, &pong_rx);
+    pthread_t t;
+    pthread_create(&t, 0, echoer, 0);
+    rask_bench_run(work, "channel pingpong 1k roundtrips");
+    return 0;
+}
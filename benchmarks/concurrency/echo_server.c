@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: (MIT OR Apache-2.0)
+// C baseline: TCP echo throughput through the green scheduler's I/O
+// engine. Server side runs as fibers (rask_async_accept/read/write);
+// four client threads hammer it with 64-byte request/response pairs
+// over loopback. One iteration = 5000 requests, so requests/sec =
+// 5000 / (median_ns / 1e9).
+//
+// No .rk twin: the Rask side goes through engine auto-detection, but
+// this benchmark must pin each backend. With RASK_IO_ENGINE unset it
+// forks itself once per backend (uring, epoll) and reports both.
+
+#define _GNU_SOURCE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+extern void rask_bench_run(void (*fn)(void), const char *name);
+
+void     rask_runtime_init(int64_t worker_count);
+void    *rask_green_spawn_fiber(void (*fn)(void *), void *arg);
+void     rask_green_detach(void *handle);
+int64_t  rask_async_read(int fd, void *buf, int64_t len);
+int64_t  rask_async_write(int fd, const void *buf, int64_t len);
+int64_t  rask_async_accept(int listen_fd);
+void     rask_io_forget_fd(int fd);
+
+#define MSG 64
+#define REQS 5000
+#define CLIENTS 4
+
+static int listen_fd;
+static int listen_port;
+
+static void conn_fiber(void *arg) {
+    int fd = (int)(intptr_t)arg;
+    char buf[MSG];
+    for (;;) {
+        int64_t n = rask_async_read(fd, buf, MSG);
+        if (n <= 0) break;
+        int64_t off = 0;
+        while (off < n) {
+            int64_t w = rask_async_write(fd, buf + off, n - off);
+            if (w <= 0) goto done;
+            off += w;
+        }
+    }
+done:
+    rask_io_forget_fd(fd); // drop fixed-file slot before the fd number recycles
+    close(fd);
+}
+
+static void acceptor(void *arg) {
+    (void)arg;
+    for (;;) {
+        int64_t fd = rask_async_accept(listen_fd);
+        if (fd < 0) break;
+        rask_green_detach(
+            rask_green_spawn_fiber(conn_fiber, (void *)(intptr_t)fd));
+    }
+}
+
+static void *client(void *arg) {
+    (void)arg;
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons((uint16_t)listen_port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        perror("echo_server: connect");
+        exit(1);
+    }
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    char buf[MSG];
+    memset(buf, 'x', MSG);
+    for (int i = 0; i < REQS / CLIENTS; i++) {
+        if (write(fd, buf, MSG) != MSG) break;
+        size_t got = 0;
+        while (got < MSG) {
+            ssize_t n = read(fd, buf, MSG - got);
+            if (n <= 0) return 0;
+            got += (size_t)n;
+        }
+    }
+    close(fd);
+    return 0;
+}
+
+static void work(void) {
+    pthread_t threads[CLIENTS];
+    for (int i = 0; i < CLIENTS; i++) {
+        pthread_create(&threads[i], 0, client, 0);
+    }
+    for (int i = 0; i < CLIENTS; i++) {
+        pthread_join(threads[i], 0);
+    }
+}
+
+int main(void) {
+    const char *eng = getenv("RASK_IO_ENGINE");
+    if (!eng) {
+        // One child per backend; each prints its own bench line
+        static const char *engines[] = { "uring", "epoll" };
+        for (int i = 0; i < 2; i++) {
+            pid_t pid = fork();
+            if (pid == 0) {
+                setenv("RASK_IO_ENGINE", engines[i], 1);
+                execl("/proc/self/exe", "echo_server", (char *)0);
+                _exit(127);
+            }
+            waitpid(pid, 0, 0);
+        }
+        return 0;
+    }
+
+    rask_runtime_init(0);
+
+    listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0; // ephemeral
+    if (bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0
+        || listen(listen_fd, 128) != 0) {
+        perror("echo_server: listen");
+        return 1;
+    }
+    socklen_t alen = sizeof(addr);
+    getsockname(listen_fd, (struct sockaddr *)&addr, &alen);
+    listen_port = ntohs(addr.sin_port);
+
+    rask_green_detach(rask_green_spawn_fiber(acceptor, 0));
+
+    char name[64];
+    snprintf(name, sizeof(name), "tcp echo 64B x%d clients (%s)", CLIENTS, eng);
+    rask_bench_run(work, name);
+    return 0;
+}
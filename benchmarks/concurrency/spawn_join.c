@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: (MIT OR Apache-2.0)
+// C baseline: green-task spawn/join rate — 1000 trivial fibers per iteration.
+
+#include <stdint.h>
+
+extern void rask_bench_run(void (*fn)(void), const char *name);
+
+void     rask_runtime_init(int64_t worker_count);
+void    *rask_green_spawn_fiber(void (*fn)(void *), void *arg);
+int64_t  rask_green_join(void *handle);
+
+#define TASKS 1000
+
+static void trivial(void *arg) {
+    (void)arg;
+}
+
+static void *handles[TASKS];
+
+static void work(void) {
+    for (int i = 0; i < TASKS; i++) {
+        handles[i] = rask_green_spawn_fiber(trivial, 0);
+    }
+    for (int i = 0; i < TASKS; i++) {
+        rask_green_join(handles[i]);
+    }
+}
+
+int main(void) {
+    rask_runtime_init(0);
+    rask_bench_run(work, "spawn 1000 tasks");
+    return 0;
+}
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: (MIT OR Apache-2.0)
+// C baseline: work stealing under imbalanced load — heavy fibers spawned
+// first, light ones queued behind them. Stealing spreads the light wave
+// across idle workers; without it the heavy tasks serialize everything.
+
+#include <stdint.h>
+
+extern void rask_bench_run(void (*fn)(void), const char *name);
+
+void     rask_runtime_init(int64_t worker_count);
+void    *rask_green_spawn_fiber(void (*fn)(void *), void *arg);
+int64_t  rask_green_join(void *handle);
+
+#define HEAVY 4
+#define LIGHT 60
+
+static volatile int64_t sink;
+
+static void burn(int64_t iters) {
+    int64_t acc = 0;
+    for (int64_t i = 0; i < iters; i++) {
+        acc += i % 7;
+    }
+    sink = acc;
+}
+
+static void heavy_task(void *arg) {
+    (void)arg;
+    burn(200000);
+}
+
+static void light_task(void *arg) {
+    (void)arg;
+    burn(2000);
+}
+
+static void *handles[HEAVY + LIGHT];
+
+static void work(void) {
+    for (int i = 0; i < HEAVY; i++) {
+        handles[i] = rask_green_spawn_fiber(heavy_task, 0);
+    }
+    for (int i = 0; i < LIGHT; i++) {
+        handles[HEAVY + i] = rask_green_spawn_fiber(light_task, 0);
+    }
+    for (int i = 0; i < HEAVY + LIGHT; i++) {
+        rask_green_join(handles[i]);
+    }
+}
+
+int main(void) {
+    rask_runtime_init(0);
+    rask_bench_run(work, "work steal 4 heavy + 60 light");
+    return 0;
+}
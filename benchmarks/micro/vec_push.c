@@ -9,6 +9,7 @@ typedef struct RaskVec RaskVec;
 RaskVec *rask_vec_new(int64_t elem_size);
 void     rask_vec_free(RaskVec *v);
 int64_t  rask_vec_push(RaskVec *v, const void *elem);
+int64_t  rask_vec_push_many(RaskVec *v, const void *elems, int64_t count);
 
 static void work(void) {
     RaskVec *v = rask_vec_new(8);
@@ -18,7 +19,17 @@ static void work(void) {
     rask_vec_free(v);
 }
 
+static int64_t bulk_src[10000];
+
+static void work_bulk(void) {
+    RaskVec *v = rask_vec_new(8);
+    rask_vec_push_many(v, bulk_src, 10000);
+    rask_vec_free(v);
+}
+
 int main(void) {
+    for (int64_t i = 0; i < 10000; i++) bulk_src[i] = i;
     rask_bench_run(work, "vec push 10k");
+    rask_bench_run(work_bulk, "vec push_many 10k");
     return 0;
 }
@@ -17,6 +17,7 @@ const PORTABLE_SOURCES: &[&str] = &[
     "random.c",
     "time.c",
     "atomic.c",
+    "cpu.c",
     "simd.c",
     "bench.c",
     "test.c",
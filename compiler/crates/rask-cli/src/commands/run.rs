@@ -599,9 +599,9 @@ pub fn cmd_run_native(path: &str, program_args: Vec<String>, format: Format, lin
     }
 }
 
-pub fn cmd_benchmark(path: &str, filter: Option<String>, format: Format) {
+pub fn cmd_benchmark(path: &str, filter: Option<String>, format: Format, baseline: Option<String>) {
     // Try native compilation first
-    if try_benchmark_native(path, filter.as_deref(), format) {
+    if try_benchmark_native(path, filter.as_deref(), format, baseline.as_deref()) {
         return;
     }
 
@@ -658,8 +658,8 @@ fn cmd_benchmark_interp(path: &str, filter: Option<String>, format: Format) {
 }
 
 /// Try compiling and running benchmarks natively. Returns true on success.
-fn try_benchmark_native(path: &str, filter: Option<&str>, format: Format) -> bool {
-    let rask_results = run_benchmark_file(path, filter, format);
+fn try_benchmark_native(path: &str, filter: Option<&str>, format: Format, baseline: Option<&str>) -> bool {
+    let rask_results = run_benchmark_file_with_baseline(path, filter, format, baseline);
     if rask_results.is_empty() {
         // run_benchmark_file returns empty on compile failure or no benchmarks
         // Check if the file has benchmarks at all (for the "no benchmarks found" message)
@@ -703,6 +703,16 @@ fn try_benchmark_native(path: &str, filter: Option<&str>, format: Format) -> boo
                 result.mean_ns as f64 / 1000.0,
                 result.median_ns as f64 / 1000.0,
                 ops_per_sec);
+            if let Some(mad) = result.mad_ns {
+                let mut extra = format!("      mad: {:>10.3}us", mad as f64 / 1000.0);
+                if let Some(allocs) = result.allocs_per_iter {
+                    extra.push_str(&format!("  allocs/iter: {}", allocs));
+                }
+                if let (Some(insn), Some(cyc)) = (result.instructions, result.cycles) {
+                    extra.push_str(&format!("  insn/iter: {}  cycles/iter: {}", insn, cyc));
+                }
+                println!("{}", extra);
+            }
 
             if let Some(c) = c_results.iter().find(|c| c.name == result.name) {
                 let ratio = result.median_ns as f64 / c.median_ns as f64;
@@ -742,6 +752,11 @@ struct BenchResult {
     max_ns: i64,
     mean_ns: i64,
     median_ns: i64,
+    // Extended harness fields; None for lines that predate them
+    mad_ns: Option<i64>,
+    allocs_per_iter: Option<i64>,
+    instructions: Option<i64>,
+    cycles: Option<i64>,
 }
 
 /// Minimal JSON parser for bench.c output lines.
@@ -756,6 +771,10 @@ fn parse_bench_json(line: &str) -> Option<BenchResult> {
         max_ns: parse_bench_json_i64(line, "max_ns")?,
         mean_ns: parse_bench_json_i64(line, "mean_ns")?,
         median_ns: parse_bench_json_i64(line, "median_ns")?,
+        mad_ns: parse_bench_json_i64(line, "mad_ns"),
+        allocs_per_iter: parse_bench_json_i64(line, "allocs_per_iter"),
+        instructions: parse_bench_json_i64(line, "instructions"),
+        cycles: parse_bench_json_i64(line, "cycles"),
     })
 }
 
@@ -1001,6 +1020,17 @@ fn parse_bench_json_i64(s: &str, key: &str) -> Option<i64> {
 
 /// Run a single .rk benchmark file natively, return parsed results.
 fn run_benchmark_file(path: &str, filter: Option<&str>, format: Format) -> Vec<BenchResult> {
+    run_benchmark_file_with_baseline(path, filter, format, None)
+}
+
+/// As run_benchmark_file, threading a baseline file into the harness via
+/// RASK_BENCH_BASELINE (bench.c flags regressions and exits nonzero).
+fn run_benchmark_file_with_baseline(
+    path: &str,
+    filter: Option<&str>,
+    format: Format,
+    baseline: Option<&str>,
+) -> Vec<BenchResult> {
     let mut result = match std::panic::catch_unwind(|| {
         crate::run_check_or_exit(path, format)
     }) {
@@ -1069,13 +1099,24 @@ fn run_benchmark_file(path: &str, filter: Option<&str>, format: Format) -> Vec<B
         return Vec::new();
     }
 
-    let output = process::Command::new(&bin_str).output();
+    let mut cmd = process::Command::new(&bin_str);
+    if let Some(b) = baseline {
+        cmd.env("RASK_BENCH_BASELINE", b);
+    }
+    let output = cmd.output();
     let _ = std::fs::remove_file(&bin_path);
 
     match output {
-        Ok(out) if out.status.success() => {
+        Ok(out) => {
+            // Regression flags from bench.c arrive on stderr; pass them on
+            eprint!("{}", String::from_utf8_lossy(&out.stderr));
             let stdout = String::from_utf8_lossy(&out.stdout);
-            stdout.lines().filter_map(|l| parse_bench_json(l)).collect()
+            let results: Vec<BenchResult> =
+                stdout.lines().filter_map(|l| parse_bench_json(l)).collect();
+            if !out.status.success() && results.is_empty() {
+                return Vec::new();
+            }
+            results
         }
         _ => Vec::new(),
     }
@@ -1098,8 +1139,13 @@ fn run_c_baseline(c_path: &std::path::Path, opt_level: &str, format: Format) ->
     let bin_str = bin_path.to_string_lossy().to_string();
 
     // Compile with cc, linking needed runtime sources (not runtime.c — it has its own main)
-    let runtime_sources = ["bench.c", "vec.c", "map.c", "pool.c", "string.c",
-                           "alloc.c", "panic.c", "args.c", "ptr.c"];
+    let mut runtime_sources = vec!["bench.c", "vec.c", "map.c", "pool.c", "string.c",
+                                   "alloc.c", "panic.c", "args.c", "ptr.c",
+                                   "channel.c", "sync.c", "thread.c", "time.c"];
+    // Green scheduler + I/O engines for the concurrency suite
+    if cfg!(target_os = "linux") {
+        runtime_sources.extend(["green.c", "io_uring_engine.c", "io_epoll_engine.c"]);
+    }
     let mut cmd = process::Command::new("cc");
     cmd.arg(opt_level);
     cmd.arg(c_path);
@@ -362,6 +362,8 @@ pub fn print_benchmark_help() {
     println!("  {} {} Filter benchmarks by name pattern", output::arg("-f"), output::arg("<pattern>"));
     println!("  {} {}  Save results as a baseline", output::arg("--save"), output::arg("<file>"));
     println!("  {} {} Compare against a saved baseline", output::arg("--compare"), output::arg("<file>"));
+    println!("  {} {} Flag regressions vs a baseline file (single-file mode;", output::arg("--baseline"), output::arg("<file>"));
+    println!("                      threshold via RASK_BENCH_THRESHOLD, default 5%)");
     println!("  {}  Compile C baselines with -O0 (fair Cranelift comparison)", output::arg("--baseline-O0"));
     println!();
     println!("{}", output::section_header("Examples:"));
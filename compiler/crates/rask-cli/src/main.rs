@@ -435,8 +435,9 @@ fn main() {
             let filter = extract_filter(&cmd_args);
             let save_path = extract_flag_value(&cmd_args, "--save");
             let compare_path = extract_flag_value(&cmd_args, "--compare");
+            let baseline_path = extract_flag_value(&cmd_args, "--baseline");
             let baseline_o0 = cmd_args.contains(&"--baseline-O0");
-            let file_arg = find_positional_arg(&cmd_args, 2, &["-f", "--save", "--compare"]);
+            let file_arg = find_positional_arg(&cmd_args, 2, &["-f", "--save", "--compare", "--baseline"]);
             let path = match file_arg {
                 Some(f) => f,
                 None => {
@@ -452,7 +453,7 @@ fn main() {
                 };
                 commands::run::cmd_benchmark_dir(path, filter, format, opts);
             } else {
-                commands::run::cmd_benchmark(path, filter, format);
+                commands::run::cmd_benchmark(path, filter, format, baseline_path);
             }
         }
         "test-specs" => {
@@ -1001,7 +1001,10 @@ impl<'a> FunctionBuilder<'a> {
                     // Pool layout (verified by _Static_assert in pool.c):
                     //   offset 16: slot_stride (i64)
                     //   offset 24: cap (i64)
-                    //   offset 40: slots (ptr)
+                    //   offset 40: chunks (ptr to chunk pointer table)
+                    // Slots live in fixed chunks of 1 << POOL_CHUNK_SHIFT:
+                    //   chunk = chunks[index >> shift]
+                    //   slot  = chunk + (index & mask) * stride
                     // Slot layout (stride varies by elem_size):
                     //   offset 0: generation (u32)
                     //   offset 8: data (elem_size bytes)
@@ -1026,10 +1029,15 @@ impl<'a> FunctionBuilder<'a> {
                     // bounds_ok: load slots pointer and stride, compute slot address
                     builder.switch_to_block(bounds_ok);
                     builder.seal_block(bounds_ok);
-                    let slots = builder.ins().load(types::I64, MemFlags::new(), pool_val, POOL_SLOTS_OFFSET);
+                    let chunks = builder.ins().load(types::I64, MemFlags::new(), pool_val, POOL_CHUNKS_OFFSET);
                     let stride = builder.ins().load(types::I64, MemFlags::new(), pool_val, POOL_STRIDE_OFFSET);
-                    let slot_offset = builder.ins().imul(index, stride);
-                    let slot_addr = builder.ins().iadd(slots, slot_offset);
+                    let chunk_idx = builder.ins().ushr_imm(index, POOL_CHUNK_SHIFT);
+                    let chunk_byte_off = builder.ins().ishl_imm(chunk_idx, 3);
+                    let chunk_ptr_addr = builder.ins().iadd(chunks, chunk_byte_off);
+                    let chunk = builder.ins().load(types::I64, MemFlags::new(), chunk_ptr_addr, 0);
+                    let slot_idx = builder.ins().band_imm(index, POOL_CHUNK_MASK);
+                    let slot_offset = builder.ins().imul(slot_idx, stride);
+                    let slot_addr = builder.ins().iadd(chunk, slot_offset);
 
                     // 3. Generation check
                     let slot_gen = builder.ins().load(types::I32, MemFlags::new(), slot_addr, SLOT_GEN_OFFSET);
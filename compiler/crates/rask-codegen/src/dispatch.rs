@@ -121,6 +121,8 @@ pub fn stdlib_entries() -> Vec<StdlibEntry> {
             params: &[types::I64, types::I64], ret_ty: Some(types::I64), can_panic: false,
             arg_adapt: ArgAdapt::WrapArg1, ret_adapt: RetAdapt::None,
         },
+        StdlibEntry::simple("Vec_extend", "rask_vec_extend", &[types::I64, types::I64], None, false),
+        StdlibEntry::simple("Vec_reserve", "rask_vec_reserve", &[types::I64, types::I64], Some(types::I64), false),
         StdlibEntry {
             mir_name: "Vec_pop", c_name: "rask_vec_pop",
             params: &[types::I64], ret_ty: Some(types::I64), can_panic: false,
@@ -194,6 +196,16 @@ pub fn stdlib_entries() -> Vec<StdlibEntry> {
             params: &[types::I64, types::I64, types::I64], ret_ty: None, can_panic: false,
             arg_adapt: ArgAdapt::StringOutParam, ret_adapt: RetAdapt::FromArgAdapt,
         },
+        // Reduction kernels — MIR lowering redirects bare Vec<f64>/Vec<i64>
+        // sums here; the rest are available for future type-directed paths.
+        StdlibEntry::simple("Vec_sum_f64", "rask_vec_sum_f64", &[types::I64], Some(types::F64), false),
+        StdlibEntry::simple("Vec_min_f64", "rask_vec_min_f64", &[types::I64], Some(types::F64), true),
+        StdlibEntry::simple("Vec_max_f64", "rask_vec_max_f64", &[types::I64], Some(types::F64), true),
+        StdlibEntry::simple("Vec_dot_f64", "rask_vec_dot_f64", &[types::I64, types::I64], Some(types::F64), true),
+        StdlibEntry::simple("Vec_sum_i64", "rask_vec_sum_i64", &[types::I64], Some(types::I64), false),
+        StdlibEntry::simple("Vec_min_i64", "rask_vec_min_i64", &[types::I64], Some(types::I64), true),
+        StdlibEntry::simple("Vec_max_i64", "rask_vec_max_i64", &[types::I64], Some(types::I64), true),
+        StdlibEntry::simple("Vec_dot_i64", "rask_vec_dot_i64", &[types::I64, types::I64], Some(types::I64), true),
         StdlibEntry::simple("Vec_sort", "rask_vec_sort", &[types::I64], None, false),
         StdlibEntry::simple("Vec_sort_by", "rask_vec_sort_by", &[types::I64, types::I64], None, false),
         StdlibEntry::simple("Vec_reverse", "rask_vec_reverse", &[types::I64], None, false),
@@ -456,6 +468,7 @@ pub fn stdlib_entries() -> Vec<StdlibEntry> {
         StdlibEntry::simple("Map_len", "rask_map_len", &[types::I64], Some(types::I64), false),
         StdlibEntry::simple("Map_is_empty", "rask_map_is_empty", &[types::I64], Some(types::I64), false),
         StdlibEntry::simple("Map_clear", "rask_map_clear", &[types::I64], None, false),
+        StdlibEntry::simple("Map_reserve", "rask_map_reserve", &[types::I64, types::I64], Some(types::I64), false),
         StdlibEntry::simple("Map_keys", "rask_map_keys", &[types::I64], Some(types::I64), false),
         StdlibEntry::simple("Map_values", "rask_map_values", &[types::I64], Some(types::I64), false),
         StdlibEntry::simple("Map_iter", "rask_map_entries", &[types::I64], Some(types::I64), false),
@@ -551,6 +564,18 @@ pub fn stdlib_entries() -> Vec<StdlibEntry> {
         StdlibEntry::simple("fs_open", "rask_fs_open", &[types::I64], Some(types::I64), false),
         StdlibEntry::simple("fs_create", "rask_fs_create", &[types::I64], Some(types::I64), false),
         StdlibEntry::simple("fs_metadata", "rask_fs_metadata", &[types::I64], Some(types::I64), false),
+        StdlibEntry {
+            mir_name: "fs_map_file", c_name: "rask_fs_map_file",
+            params: &[types::I64, types::I64], ret_ty: None, can_panic: false,
+            arg_adapt: ArgAdapt::StringOutParam, ret_adapt: RetAdapt::FromArgAdapt,
+        },
+        StdlibEntry::simple("fs_lines", "rask_fs_lines", &[types::I64], Some(types::I64), false),
+        StdlibEntry {
+            mir_name: "LineReader_next", c_name: "rask_line_reader_next",
+            params: &[types::I64], ret_ty: Some(types::I64), can_panic: false,
+            arg_adapt: ArgAdapt::None, ret_adapt: RetAdapt::DerefOption,
+        },
+        StdlibEntry::simple("LineReader_close", "rask_line_reader_free", &[types::I64], None, false),
 
         // ── Metadata methods ────────────────────────────────────────
         StdlibEntry::simple("Metadata_size", "rask_metadata_size", &[types::I64], Some(types::I64), false),
@@ -606,6 +631,7 @@ pub fn stdlib_entries() -> Vec<StdlibEntry> {
             arg_adapt: ArgAdapt::AppendOutParam, ret_adapt: RetAdapt::FromArgAdapt,
         },
         StdlibEntry::simple("TcpConnection_write_all", "rask_net_write_all", &[types::I64, types::I64], Some(types::I64), false),
+        StdlibEntry::simple("TcpConnection_write_many", "rask_net_write_many", &[types::I64, types::I64], Some(types::I64), false),
         StdlibEntry {
             mir_name: "TcpConnection_remote_addr", c_name: "rask_net_remote_addr",
             params: &[types::I64, types::I64], ret_ty: None, can_panic: false,
@@ -659,6 +685,7 @@ pub fn stdlib_entries() -> Vec<StdlibEntry> {
             params: &[types::I64, types::I64], ret_ty: None, can_panic: false,
             arg_adapt: ArgAdapt::StringOutParam, ret_adapt: RetAdapt::FromArgAdapt,
         },
+        StdlibEntry::simple("json_buf_reset", "rask_json_buf_reset", &[types::I64], None, false),
         StdlibEntry::simple("json_buf_new_array", "rask_json_buf_new_array", &[], Some(types::I64), false),
         StdlibEntry::simple("json_buf_array_add_raw", "rask_json_buf_array_add_raw", &[types::I64, types::I64], None, false),
         StdlibEntry::simple("json_buf_array_add_string", "rask_json_buf_array_add_string", &[types::I64, types::I64], None, false),
@@ -974,6 +1001,11 @@ pub fn stdlib_entries() -> Vec<StdlibEntry> {
             entries.push(StdlibEntry::simple(leak_str(&format!("{}_{}", simd_type, op)), leak_str(&format!("rask_simd_{}_{}", simd_type, op)), &[types::I64, types::I64], Some(types::I64), false));
         }
         entries.push(StdlibEntry::simple(leak_str(&format!("{}_scale", simd_type)), leak_str(&format!("rask_simd_{}_scale", simd_type)), &[types::I64, types::F64], Some(types::I64), false));
+        entries.push(StdlibEntry::simple(leak_str(&format!("{}_fma", simd_type)), leak_str(&format!("rask_simd_{}_fma", simd_type)), &[types::I64, types::I64, types::I64], Some(types::I64), false));
+        for op in &["min_each", "max_each", "eq", "ne", "lt", "le", "gt", "ge"] {
+            entries.push(StdlibEntry::simple(leak_str(&format!("{}_{}", simd_type, op)), leak_str(&format!("rask_simd_{}_{}", simd_type, op)), &[types::I64, types::I64], Some(types::I64), false));
+        }
+        entries.push(StdlibEntry::simple(leak_str(&format!("{}_blend", simd_type)), leak_str(&format!("rask_simd_{}_blend", simd_type)), &[types::I64, types::I64, types::I64], Some(types::I64), false));
         for op in &["sum", "product", "min", "max"] {
             entries.push(StdlibEntry::simple(leak_str(&format!("{}_{}", simd_type, op)), leak_str(&format!("rask_simd_{}_{}", simd_type, op)), &[types::I64], Some(types::F64), false));
         }
@@ -981,7 +1013,7 @@ pub fn stdlib_entries() -> Vec<StdlibEntry> {
         entries.push(StdlibEntry::simple(leak_str(&format!("{}_set", simd_type)), leak_str(&format!("rask_simd_{}_set", simd_type)), &[types::I64, types::I64, types::F64], None, false));
     }
 
-    for simd_type in &["i32x4", "i32x8"] {
+    for simd_type in &["i32x4", "i32x8", "i64x4"] {
         entries.push(StdlibEntry::simple(leak_str(&format!("{}_splat", simd_type)), leak_str(&format!("rask_simd_{}_splat", simd_type)), &[types::I64], Some(types::I64), false));
         entries.push(StdlibEntry::simple(leak_str(&format!("{}_load", simd_type)), leak_str(&format!("rask_simd_{}_load", simd_type)), &[types::I64], Some(types::I64), false));
         entries.push(StdlibEntry::simple(leak_str(&format!("{}_store", simd_type)), leak_str(&format!("rask_simd_{}_store", simd_type)), &[types::I64, types::I64], None, false));
@@ -989,6 +1021,10 @@ pub fn stdlib_entries() -> Vec<StdlibEntry> {
             entries.push(StdlibEntry::simple(leak_str(&format!("{}_{}", simd_type, op)), leak_str(&format!("rask_simd_{}_{}", simd_type, op)), &[types::I64, types::I64], Some(types::I64), false));
         }
         entries.push(StdlibEntry::simple(leak_str(&format!("{}_scale", simd_type)), leak_str(&format!("rask_simd_{}_scale", simd_type)), &[types::I64, types::I64], Some(types::I64), false));
+        for op in &["min_each", "max_each", "shl", "shr", "and", "or", "xor", "eq", "ne", "lt", "le", "gt", "ge"] {
+            entries.push(StdlibEntry::simple(leak_str(&format!("{}_{}", simd_type, op)), leak_str(&format!("rask_simd_{}_{}", simd_type, op)), &[types::I64, types::I64], Some(types::I64), false));
+        }
+        entries.push(StdlibEntry::simple(leak_str(&format!("{}_blend", simd_type)), leak_str(&format!("rask_simd_{}_blend", simd_type)), &[types::I64, types::I64, types::I64], Some(types::I64), false));
         for op in &["sum", "product", "min", "max"] {
             entries.push(StdlibEntry::simple(leak_str(&format!("{}_{}", simd_type, op)), leak_str(&format!("rask_simd_{}_{}", simd_type, op)), &[types::I64], Some(types::I64), false));
         }
@@ -8,7 +8,11 @@
 // ── Pool (pool.c) ────────────────────────────────────────────────
 pub const POOL_STRIDE_OFFSET: i32 = 16;
 pub const POOL_CAP_OFFSET: i32 = 24;
-pub const POOL_SLOTS_OFFSET: i32 = 40;
+pub const POOL_CHUNKS_OFFSET: i32 = 40;
+// Slots live in fixed chunks of 1 << POOL_CHUNK_SHIFT; the chunk table
+// holds one pointer per chunk. Must match POOL_CHUNK_SHIFT in pool.c.
+pub const POOL_CHUNK_SHIFT: i64 = 8;
+pub const POOL_CHUNK_MASK: i64 = (1 << POOL_CHUNK_SHIFT) - 1;
 pub const SLOT_GEN_OFFSET: i32 = 0;
 pub const SLOT_DATA_OFFSET: i32 = 8;
 
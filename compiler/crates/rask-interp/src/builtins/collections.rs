@@ -42,6 +42,14 @@ impl Interpreter {
                     variant_index: 0, origin: None,
                 })
             }
+            "extend" => {
+                let other = args.into_iter().next().unwrap_or(Value::Unit);
+                if let Value::Vec(o) = other {
+                    let items: Vec<Value> = o.lock().unwrap().clone();
+                    v.lock().unwrap().extend(items);
+                }
+                Ok(Value::Unit)
+            }
             "pop" => {
                 let result = v.lock().unwrap().pop();
                 match result {
@@ -1142,6 +1150,14 @@ impl Interpreter {
                 m.lock().unwrap().clear();
                 Ok(Value::Unit)
             }
+            "reserve" => {
+                let additional = match args.get(0) {
+                    Some(Value::Int(n, _)) => *n as usize,
+                    _ => 0,
+                };
+                m.lock().unwrap().reserve(additional);
+                Ok(Value::Unit)
+            }
             "iter" => {
                 let map = m.lock().unwrap();
                 let pairs: Vec<Value> = map
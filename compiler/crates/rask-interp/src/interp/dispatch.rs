@@ -245,6 +245,10 @@ impl Interpreter {
                 let guard = s.lock().unwrap();
                 self.call_metadata_method(&guard.fields, method)
             }
+            #[cfg(not(target_arch = "wasm32"))]
+            Value::Struct(ref s) if s.lock().unwrap().name == "LineReader" => {
+                self.call_line_reader_method(s, method)
+            }
             Value::Struct(ref s) if s.lock().unwrap().name == "Path" => {
                 let guard = s.lock().unwrap();
                 self.call_path_instance_method(&guard.fields, method, args)
@@ -615,7 +619,8 @@ impl Interpreter {
         use crate::value::ModuleKind::*;
         match module {
             Fs => matches!(method,
-                "read_file" | "read_bytes" | "read_lines" | "write_file" | "write_bytes"
+                "read_file" | "read_bytes" | "read_lines" | "map_file" | "lines"
+                | "write_file" | "write_bytes"
                 | "append_file" | "exists" | "open" | "create" | "canonicalize" | "metadata"
                 | "delete" | "remove" | "remove_dir" | "create_dir" | "create_dir_all"
                 | "rename" | "copy" | "list_dir"
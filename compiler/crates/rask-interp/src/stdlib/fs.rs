@@ -57,6 +57,27 @@ impl Interpreter {
                     }),
                 }
             }
+            // Interpreter has no streaming buffers — read eagerly, iterate
+            // via a cursor so the surface matches the native reader.
+            "lines" => {
+                let path = self.expect_string(&args, 0)?;
+                let lines: Vec<Value> = std::fs::read_to_string(&path)
+                    .unwrap_or_default()
+                    .lines()
+                    .map(|l| Value::String(Arc::new(Mutex::new(l.to_string()))))
+                    .collect();
+                let mut fields = IndexMap::new();
+                fields.insert("lines".to_string(), Value::Vec(Arc::new(Mutex::new(lines))));
+                fields.insert("pos".to_string(), Value::int(0));
+                Ok(Value::new_struct("LineReader".to_string(), fields, None))
+            }
+            // Interpreter has no mmap path — plain read, empty string on failure
+            // to match the native signature.
+            "map_file" => {
+                let path = self.expect_string(&args, 0)?;
+                let content = std::fs::read_to_string(&path).unwrap_or_default();
+                Ok(Value::String(Arc::new(Mutex::new(content))))
+            }
             "read_lines" => {
                 let path = self.expect_string(&args, 0)?;
                 match std::fs::read_to_string(&path) {
@@ -513,6 +534,43 @@ impl Interpreter {
         }
     }
 
+    /// Handle LineReader instance methods (next, close).
+    pub(crate) fn call_line_reader_method(
+        &mut self,
+        s: &Arc<Mutex<crate::value::StructData>>,
+        method: &str,
+    ) -> Result<Value, RuntimeError> {
+        match method {
+            "next" => {
+                let mut guard = s.lock().unwrap();
+                let pos = match guard.fields.get("pos") {
+                    Some(Value::Int(n, _)) => *n as usize,
+                    _ => 0,
+                };
+                let line = match guard.fields.get("lines") {
+                    Some(Value::Vec(v)) => v.lock().unwrap().get(pos).cloned(),
+                    _ => None,
+                };
+                match line {
+                    Some(val) => {
+                        guard.fields.insert("pos".to_string(), Value::int(pos as i64 + 1));
+                        Ok(Value::enum_val("Option".to_string(), "Some".to_string(), vec![val]))
+                    }
+                    None => Ok(Value::enum_val("Option".to_string(), "None".to_string(), vec![])),
+                }
+            }
+            "close" => {
+                let mut guard = s.lock().unwrap();
+                guard.fields.insert("lines".to_string(), Value::Vec(Arc::new(Mutex::new(Vec::new()))));
+                Ok(Value::Unit)
+            }
+            _ => Err(RuntimeError::NoSuchMethod {
+                ty: "LineReader".to_string(),
+                method: method.to_string(),
+            }),
+        }
+    }
+
     /// Handle Metadata struct methods.
     pub(crate) fn call_metadata_method(
         &self,
@@ -146,6 +146,28 @@ impl Interpreter {
                     Err(e) => Ok(make_result_err(&e.to_string())),
                 }
             }
+            "write_many" => {
+                // No vectored I/O in std — concatenate and write once,
+                // same single-flush semantics as the native writev path.
+                let segments = match args.first() {
+                    Some(Value::Vec(v)) => v.lock().unwrap().clone(),
+                    _ => return Err(RuntimeError::ArityMismatch { expected: 1, got: 0 }),
+                };
+                let mut data = String::new();
+                for seg in &segments {
+                    if let Value::String(s) = seg {
+                        data.push_str(&s.lock().unwrap());
+                    }
+                }
+                let mut guard = stream.lock().unwrap();
+                let s = guard.as_mut().ok_or_else(|| {
+                    RuntimeError::ResourceClosed { resource_type: "TcpConnection".to_string(), operation: "write to".to_string() }
+                })?;
+                match s.write_all(data.as_bytes()).and_then(|_| s.flush()) {
+                    Ok(()) => Ok(make_result_ok(Value::Unit)),
+                    Err(e) => Ok(make_result_err(&e.to_string())),
+                }
+            }
             "remote_addr" => {
                 let guard = stream.lock().unwrap();
                 let s = guard.as_ref().ok_or_else(|| {
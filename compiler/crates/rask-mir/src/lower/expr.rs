@@ -1261,7 +1261,7 @@ impl<'a> MirLowerer<'a> {
                     || if let ExprKind::Ident(var_name) = &object.kind {
                         self.meta(var_name)
                             .and_then(|m| m.type_prefix.as_deref())
-                            .map(|p| matches!(p, "string" | "f32x4" | "f32x8" | "f64x2" | "f64x4" | "i32x4" | "i32x8" | "Ptr"))
+                            .map(|p| matches!(p, "string" | "f32x4" | "f32x8" | "f64x2" | "f64x4" | "i32x4" | "i32x8" | "i64x4" | "Ptr"))
                             .unwrap_or(false)
                     } else {
                         // Unknown type from complex expression — default to native
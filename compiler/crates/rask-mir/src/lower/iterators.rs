@@ -605,6 +605,37 @@ impl<'a> MirLowerer<'a> {
         &mut self,
         chain: &super::IterChain<'_>,
     ) -> Result<TypedOperand, LoweringError> {
+        // Bare Vec<f64>/Vec<i64> sum with no adapters: one call into the
+        // runtime reduction kernel instead of a per-element indexed loop.
+        if chain.adapters.is_empty() {
+            let kernel = match self.ctx.lookup_raw_type(chain.source.id) {
+                Some(rask_types::Type::UnresolvedGeneric { name, args })
+                    if name == "Vec" && args.len() == 1 =>
+                {
+                    match &args[0] {
+                        rask_types::GenericArg::Type(t) if **t == rask_types::Type::F64 => {
+                            Some(("Vec_sum_f64", MirType::F64))
+                        }
+                        rask_types::GenericArg::Type(t) if **t == rask_types::Type::I64 => {
+                            Some(("Vec_sum_i64", MirType::I64))
+                        }
+                        _ => None,
+                    }
+                }
+                _ => None,
+            };
+            if let Some((kernel, ret_ty)) = kernel {
+                let (src_op, _) = self.lower_expr(chain.source)?;
+                let dst = self.builder.alloc_temp(ret_ty.clone());
+                self.builder.push_stmt(MirStmt::dummy(MirStmtKind::Call {
+                    dst: Some(dst),
+                    func: FunctionRef::internal(kernel.to_string()),
+                    args: vec![src_op],
+                }));
+                return Ok((MirOperand::Local(dst), ret_ty));
+            }
+        }
+
         let acc = self.builder.alloc_temp(MirType::I64);
         self.builder.push_stmt(MirStmt::dummy(MirStmtKind::Assign {
             dst: acc,
@@ -1960,6 +1960,7 @@ fn is_simd_prefix(name: &str) -> bool {
     name.starts_with("f32x4_") || name.starts_with("f32x8_")
         || name.starts_with("f64x2_") || name.starts_with("f64x4_")
         || name.starts_with("i32x4_") || name.starts_with("i32x8_")
+        || name.starts_with("i64x4_")
 }
 
 /// SIMD methods that return a scalar, not a vector.
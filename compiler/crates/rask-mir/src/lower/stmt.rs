@@ -612,8 +612,16 @@ impl<'a> MirLowerer<'a> {
                     _ => {}
                 }
             }
-            // String methods that always return Vec<string>
-            match method.as_str() {
+            // String methods that always return Vec<string>.
+            // `.collect()` is transparent: `s.split(",").collect()` has the
+            // same element type as the split itself.
+            let mut eff_method = method.as_str();
+            if eff_method == "collect" {
+                if let ExprKind::MethodCall { method: inner, .. } = &object.kind {
+                    eff_method = inner.as_str();
+                }
+            }
+            match eff_method {
                 "lines" | "split" | "split_whitespace" => {
                     self.meta_mut(name).elem_type = Some(MirType::String);
                 }
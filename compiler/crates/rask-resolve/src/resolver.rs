@@ -304,6 +304,7 @@ impl Resolver {
                 ("f64x4", BuiltinTypeKind::Simd),
                 ("i32x4", BuiltinTypeKind::Simd),
                 ("i32x8", BuiltinTypeKind::Simd),
+                ("i64x4", BuiltinTypeKind::Simd),
             ],
             _ => &[],
         };
@@ -409,7 +410,7 @@ impl Resolver {
         let builtin_type = match (module, symbol) {
             ("fs", "File") => Some(BuiltinTypeKind::File),
             ("random", "Rng") => Some(BuiltinTypeKind::Rng),
-            ("math", "f32x4" | "f32x8" | "f64x2" | "f64x4" | "i32x4" | "i32x8") => Some(BuiltinTypeKind::Simd),
+            ("math", "f32x4" | "f32x8" | "f64x2" | "f64x4" | "i32x4" | "i32x8" | "i64x4") => Some(BuiltinTypeKind::Simd),
             _ => None,
         };
         if let Some(kind) = builtin_type {
@@ -132,7 +132,7 @@ pub enum BuiltinTypeKind {
     Mutex,
     /// Owned<T> - heap-allocated owned value
     Owned,
-    /// SIMD vector types (f32x4, f32x8, i32x4, i32x8, f64x2, f64x4)
+    /// SIMD vector types (f32x4, f32x8, i32x4, i32x8, i64x4, f64x2, f64x4)
     Simd,
     /// Rng - random number generator
     Rng,
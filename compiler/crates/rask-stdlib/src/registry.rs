@@ -31,14 +31,14 @@ pub fn type_layer(type_name: &str) -> StdlibLayer {
         | "f64" | "bool" | "char" | "string"
         | "Vec" | "Map" | "Pool" | "Handle"
         | "Result" | "Option"
-        | "f32x4" | "f32x8" | "f64x2" | "f64x4" | "i32x4" | "i32x8"
+        | "f32x4" | "f32x8" | "f64x2" | "f64x4" | "i32x4" | "i32x8" | "i64x4"
         | "JsonValue" | "Path" | "Args" | "Duration" => StdlibLayer::Pure,
 
         "ThreadHandle" | "Sender" | "Receiver" | "Shared" | "Mutex"
         | "AtomicBool" | "AtomicI8" | "AtomicU8"
         | "AtomicI16" | "AtomicU16" | "AtomicI32" | "AtomicU32"
         | "AtomicI64" | "AtomicU64" | "AtomicUsize" | "AtomicIsize"
-        | "File" | "Metadata"
+        | "File" | "LineReader" | "Metadata"
         | "TcpListener" | "TcpConnection"
         | "Instant" => StdlibLayer::Runtime,
 
@@ -155,12 +155,14 @@ const FILE_METHODS: &[&str] = &[
     "close", "read_all", "read_text", "write", "write_line", "lines",
 ];
 
+const LINE_READER_METHODS: &[&str] = &["next", "close"];
+
 const METADATA_METHODS: &[&str] = &["size", "accessed", "modified"];
 
 const TCP_LISTENER_METHODS: &[&str] = &["accept", "close", "clone"];
 
 const TCP_CONNECTION_METHODS: &[&str] = &[
-    "read_all", "write_all", "remote_addr",
+    "read_all", "write_all", "write_many", "remote_addr",
     "read_http_request", "write_http_response",
     "close", "clone",
 ];
@@ -194,6 +196,9 @@ const MUTEX_METHODS: &[&str] = &["lock", "try_lock", "clone"];
 const SIMD_METHODS: &[&str] = &[
     "splat", "load", "store",
     "add", "sub", "mul", "div", "scale",
+    "fma", "min_each", "max_each",
+    "shl", "shr", "and", "or", "xor",
+    "eq", "ne", "lt", "le", "gt", "ge", "blend",
     "sum", "product", "min", "max",
     "get", "set",
 ];
@@ -217,7 +222,7 @@ const ATOMIC_INT_METHODS: &[&str] = &[
 // ---------------------------------------------------------------------------
 
 const FS_METHODS: &[&str] = &[
-    "read_file", "read_bytes", "read_lines", "write_file", "write_bytes",
+    "read_file", "read_bytes", "read_lines", "map_file", "lines", "write_file", "write_bytes",
     "append_file", "exists", "open", "create", "canonicalize", "metadata",
     "remove", "remove_dir", "create_dir", "create_dir_all",
     "rename", "copy",
@@ -261,7 +266,7 @@ pub const REGISTERED_TYPES: &[&str] = &[
     "f64", "bool", "char", "string",
     "Vec", "Map", "Pool", "Handle",
     "Result", "Option",
-    "File", "Metadata",
+    "File", "LineReader", "Metadata",
     "TcpListener", "TcpConnection",
     "JsonValue",
     "Duration", "Instant",
@@ -270,7 +275,7 @@ pub const REGISTERED_TYPES: &[&str] = &[
     "AtomicBool", "AtomicI8", "AtomicU8",
     "AtomicI16", "AtomicU16", "AtomicI32", "AtomicU32",
     "AtomicI64", "AtomicU64", "AtomicUsize", "AtomicIsize",
-    "f32x4", "f32x8", "f64x2", "f64x4", "i32x4", "i32x8",
+    "f32x4", "f32x8", "f64x2", "f64x4", "i32x4", "i32x8", "i64x4",
 ];
 
 /// All modules with registered functions.
@@ -296,6 +301,7 @@ pub fn type_method_names(type_name: &str) -> &'static [&'static str] {
         "Result" => RESULT_METHODS,
         "Option" => OPTION_METHODS,
         "File" => FILE_METHODS,
+        "LineReader" => LINE_READER_METHODS,
         "Metadata" => METADATA_METHODS,
         "TcpListener" => TCP_LISTENER_METHODS,
         "TcpConnection" => TCP_CONNECTION_METHODS,
@@ -314,7 +320,7 @@ pub fn type_method_names(type_name: &str) -> &'static [&'static str] {
         "AtomicI8" | "AtomicU8" | "AtomicI16" | "AtomicU16"
         | "AtomicI32" | "AtomicU32" | "AtomicI64" | "AtomicU64"
         | "AtomicUsize" | "AtomicIsize" => ATOMIC_INT_METHODS,
-        "f32x4" | "f32x8" | "f64x2" | "f64x4" | "i32x4" | "i32x8" => SIMD_METHODS,
+        "f32x4" | "f32x8" | "f64x2" | "f64x4" | "i32x4" | "i32x8" | "i64x4" => SIMD_METHODS,
         _ => &[],
     }
 }
@@ -341,7 +347,7 @@ pub fn is_codegen_only_type(type_name: &str) -> bool {
     matches!(type_name,
         "AtomicI8" | "AtomicU8" | "AtomicI16" | "AtomicU16"
         | "AtomicI32" | "AtomicU32" | "AtomicI64" | "AtomicIsize"
-        | "f32x4" | "f32x8" | "f64x2" | "f64x4" | "i32x4" | "i32x8"
+        | "f32x4" | "f32x8" | "f64x2" | "f64x4" | "i32x4" | "i32x8" | "i64x4"
     )
 }
 
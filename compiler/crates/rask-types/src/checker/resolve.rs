@@ -484,7 +484,7 @@ impl TypeChecker {
                     })
                 }
             }
-            // SIMD vector types (f32x4, f32x8, i32x4, i32x8, f64x2, f64x4)
+            // SIMD vector types (f32x4, f32x8, i32x4, i32x8, i64x4, f64x2, f64x4)
             Type::UnresolvedNamed(name) if Self::is_simd_type(name) => {
                 self.resolve_simd_method(name, &method, &args, &ret, span)
             }
@@ -2350,7 +2350,7 @@ impl TypeChecker {
     fn is_simd_type(name: &str) -> bool {
         matches!(
             name,
-            "f32x4" | "f32x8" | "f64x2" | "f64x4" | "i32x4" | "i32x8"
+            "f32x4" | "f32x8" | "f64x2" | "f64x4" | "i32x4" | "i32x8" | "i64x4"
         )
     }
 
@@ -2363,6 +2363,7 @@ impl TypeChecker {
             "f64x4" => (Type::F64, 4),
             "i32x4" => (Type::I32, 4),
             "i32x8" => (Type::I32, 8),
+            "i64x4" => (Type::I64, 4),
             _ => (Type::F32, 4), // unreachable given is_simd_type guard
         }
     }
@@ -2411,6 +2412,50 @@ impl TypeChecker {
                 let _ = self.unify(&args[0], &self_ty, span);
                 self.unify(ret, &self_ty, span)
             }
+            // min_each(other) → vec, max_each(other) → vec (lanewise; the
+            // nullary min/max below are horizontal reductions)
+            "min_each" | "max_each" if args.len() == 1 => {
+                let _ = self.unify(&args[0], &self_ty, span);
+                self.unify(ret, &self_ty, span)
+            }
+            // fma(b, c) → vec — fused self*b + c, float lanes only
+            "fma" if args.len() == 2
+                && matches!(elem_ty, Type::F32 | Type::F64) =>
+            {
+                let _ = self.unify(&args[0], &self_ty, span);
+                let _ = self.unify(&args[1], &self_ty, span);
+                self.unify(ret, &self_ty, span)
+            }
+
+            // ── Integer lanes only ──────────────────────────
+            // shl(bits) → vec, shr(bits) → vec (arithmetic shift)
+            "shl" | "shr" if args.len() == 1
+                && matches!(elem_ty, Type::I32 | Type::I64) =>
+            {
+                let _ = self.unify(&args[0], &Type::I64, span);
+                self.unify(ret, &self_ty, span)
+            }
+            // and(other) → vec, or(other) → vec, xor(other) → vec
+            "and" | "or" | "xor" if args.len() == 1
+                && matches!(elem_ty, Type::I32 | Type::I64) =>
+            {
+                let _ = self.unify(&args[0], &self_ty, span);
+                self.unify(ret, &self_ty, span)
+            }
+
+            // ── Compare / mask / blend ──────────────────────
+            // Comparisons produce a mask vector of the same type with 1/0
+            // lanes; blend selects self-lanes where the mask is nonzero.
+            "eq" | "ne" | "lt" | "le" | "gt" | "ge" if args.len() == 1 => {
+                let _ = self.unify(&args[0], &self_ty, span);
+                self.unify(ret, &self_ty, span)
+            }
+            // blend(other, mask) → vec
+            "blend" if args.len() == 2 => {
+                let _ = self.unify(&args[0], &self_ty, span);
+                let _ = self.unify(&args[1], &self_ty, span);
+                self.unify(ret, &self_ty, span)
+            }
 
             // ── Scalar broadcast ops ────────────────────────
             // scale(scalar) → vec (multiply by scalar)
@@ -53,7 +53,11 @@ static atomic_int_least64_t stat_bytes_freed;
 static atomic_int_least64_t stat_current_bytes;
 static atomic_int_least64_t stat_peak_bytes;
 
+static void profile_track(int64_t size);
+extern int rask_alloc_profile_enabled;
+
 static void stats_track_alloc(int64_t size) {
+    if (__builtin_expect(rask_alloc_profile_enabled, 0)) profile_track(size);
     atomic_fetch_add_explicit(&stat_alloc_count, 1, memory_order_relaxed);
     atomic_fetch_add_explicit(&stat_bytes_allocated, size, memory_order_relaxed);
     int64_t current = atomic_fetch_add_explicit(&stat_current_bytes, size,
@@ -131,3 +135,346 @@ void rask_free(void *ptr) {
         atomic_fetch_add_explicit(&stat_free_count, 1, memory_order_relaxed);
     }
 }
+
+// ─── Allocation profiler (RASK_ALLOC_PROFILE=1) ────────────
+//
+// Opt-in, like RASK_RUNTIME_CHECKS: main() flips the flag and registers
+// the dump at exit. Records a power-of-two size histogram plus per-call-
+// site counts, attributed through the thread-local panic location that
+// codegen already sets before runtime calls — no symbolization or
+// external heap profiler needed, and it sees green-task allocations
+// because the location is per worker thread.
+
+int rask_alloc_profile_enabled = 0;
+
+extern const char *rask_panic_location_file(int32_t *line, int32_t *col);
+
+#define PROF_HIST_BUCKETS 32
+#define PROF_SITE_CAP     1024   // open addressing, power of two
+
+static atomic_int_least64_t prof_hist_count[PROF_HIST_BUCKETS];
+static atomic_int_least64_t prof_hist_bytes[PROF_HIST_BUCKETS];
+
+typedef struct {
+    const char *file;    // static string from codegen — pointer identity
+    int32_t     line;
+    int32_t     col;
+    int64_t     count;
+    int64_t     bytes;
+} ProfSite;
+
+static ProfSite    prof_sites[PROF_SITE_CAP];
+static atomic_flag prof_site_lock = ATOMIC_FLAG_INIT;
+static int64_t     prof_sites_dropped;
+
+// Bucket b covers sizes (2^(b-1), 2^b].
+static int prof_bucket(int64_t size) {
+    int b = 0;
+    int64_t s = 1;
+    while (s < size && b < PROF_HIST_BUCKETS - 1) {
+        s <<= 1;
+        b++;
+    }
+    return b;
+}
+
+static void profile_track(int64_t size) {
+    int b = prof_bucket(size);
+    atomic_fetch_add_explicit(&prof_hist_count[b], 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&prof_hist_bytes[b], size, memory_order_relaxed);
+
+    int32_t line, col;
+    const char *file = rask_panic_location_file(&line, &col);
+    if (!file || line <= 0) return; // allocation outside instrumented code
+
+    uint64_t h = (uint64_t)(uintptr_t)file * 0x9E3779B97F4A7C15ULL;
+    h ^= ((uint64_t)(uint32_t)line << 20) ^ (uint64_t)(uint32_t)col;
+
+    while (atomic_flag_test_and_set_explicit(&prof_site_lock, memory_order_acquire)) {}
+    for (int i = 0; i < PROF_SITE_CAP; i++) {
+        ProfSite *s = &prof_sites[(h + (uint64_t)i) & (PROF_SITE_CAP - 1)];
+        if (!s->file) {
+            s->file = file;
+            s->line = line;
+            s->col  = col;
+        }
+        if (s->file == file && s->line == line && s->col == col) {
+            s->count++;
+            s->bytes += size;
+            atomic_flag_clear_explicit(&prof_site_lock, memory_order_release);
+            return;
+        }
+    }
+    prof_sites_dropped++;
+    atomic_flag_clear_explicit(&prof_site_lock, memory_order_release);
+}
+
+// One JSON object on stderr so it doesn't mix with program output.
+void rask_alloc_profile_dump(void) {
+    fprintf(stderr, "{\"alloc_profile\":{\"histogram\":[");
+    int first = 1;
+    for (int b = 0; b < PROF_HIST_BUCKETS; b++) {
+        int64_t count = atomic_load_explicit(&prof_hist_count[b], memory_order_relaxed);
+        if (count == 0) continue;
+        int64_t bytes = atomic_load_explicit(&prof_hist_bytes[b], memory_order_relaxed);
+        fprintf(stderr, "%s{\"size_le\":%lld,\"count\":%lld,\"bytes\":%lld}",
+                first ? "" : ",",
+                (long long)(1LL << b), (long long)count, (long long)bytes);
+        first = 0;
+    }
+    fprintf(stderr, "],\"call_sites\":[");
+    first = 1;
+    for (int i = 0; i < PROF_SITE_CAP; i++) {
+        ProfSite *s = &prof_sites[i];
+        if (!s->file) continue;
+        fprintf(stderr, "%s{\"site\":\"%s:%d:%d\",\"count\":%lld,\"bytes\":%lld}",
+                first ? "" : ",",
+                s->file, s->line, s->col,
+                (long long)s->count, (long long)s->bytes);
+        first = 0;
+    }
+    fprintf(stderr, "],\"sites_dropped\":%lld}}\n", (long long)prof_sites_dropped);
+}
+
+// ─── Thread-local slab backend ─────────────────────────────
+//
+// Size-class allocator with per-thread free lists. Hot small sizes
+// (string headers, Vec growth blocks, green task state) are served from
+// a thread-local bump region with zero locking; anything above the
+// largest class falls back to malloc. Frees push onto the freeing
+// thread's list, so blocks migrate between workers under producer/
+// consumer patterns — that's fine, classes are uniform.
+//
+// Selected with RASK_ALLOC=slab (installed in main before the first
+// allocation). Backing chunks are never returned to the OS; blocks
+// recirculate through the free lists.
+
+#define SLAB_CLASS_COUNT 8
+#define SLAB_CHUNK_SIZE  (64 * 1024)
+#define SLAB_HEADER      16         // keeps payloads 16-byte aligned
+#define SLAB_CLASS_LARGE -1
+
+static const int64_t slab_class_size[SLAB_CLASS_COUNT] = {
+    16, 32, 48, 64, 96, 128, 192, 256,
+};
+
+typedef struct SlabBlock {
+    struct SlabBlock *next;
+} SlabBlock;
+
+static __thread SlabBlock *tl_slab_free[SLAB_CLASS_COUNT];
+static __thread char      *tl_slab_bump;
+static __thread int64_t    tl_slab_bump_left;
+
+static int slab_class_for(int64_t size) {
+    for (int c = 0; c < SLAB_CLASS_COUNT; c++) {
+        if (size <= slab_class_size[c]) return c;
+    }
+    return SLAB_CLASS_LARGE;
+}
+
+// Block layout: [tag: i64][pad: 8B][payload]. The tag is the size class,
+// or SLAB_CLASS_LARGE for malloc fallback. Free-listed blocks reuse the
+// header for the next pointer; the tag is rewritten on pop.
+static void *slab_alloc(int64_t size, void *ctx) {
+    (void)ctx;
+    int c = slab_class_for(size);
+    if (c == SLAB_CLASS_LARGE) {
+        char *p = (char *)malloc((size_t)(SLAB_HEADER + size));
+        if (!p) return NULL;
+        *(int64_t *)p = SLAB_CLASS_LARGE;
+        return p + SLAB_HEADER;
+    }
+
+    SlabBlock *b = tl_slab_free[c];
+    if (b) {
+        tl_slab_free[c] = b->next;
+        *(int64_t *)b = c;
+        return (char *)b + SLAB_HEADER;
+    }
+
+    int64_t need = SLAB_HEADER + slab_class_size[c];
+    if (tl_slab_bump_left < need) {
+        char *chunk = (char *)malloc(SLAB_CHUNK_SIZE);
+        if (!chunk) return NULL;
+        tl_slab_bump = chunk;
+        tl_slab_bump_left = SLAB_CHUNK_SIZE;
+    }
+    char *p = tl_slab_bump;
+    tl_slab_bump += need;
+    tl_slab_bump_left -= need;
+    *(int64_t *)p = c;
+    return p + SLAB_HEADER;
+}
+
+static void slab_free(void *ptr, void *ctx) {
+    (void)ctx;
+    if (!ptr) return;
+    char *p = (char *)ptr - SLAB_HEADER;
+    int64_t tag = *(int64_t *)p;
+    if (tag == SLAB_CLASS_LARGE) {
+        free(p);
+        return;
+    }
+    SlabBlock *b = (SlabBlock *)p;
+    b->next = tl_slab_free[tag];
+    tl_slab_free[tag] = b;
+}
+
+static void *slab_realloc(void *ptr, int64_t old_size, int64_t new_size, void *ctx) {
+    if (!ptr) return slab_alloc(new_size, ctx);
+    char *p = (char *)ptr - SLAB_HEADER;
+    int64_t tag = *(int64_t *)p;
+    // Growth within the same class is free
+    if (tag != SLAB_CLASS_LARGE && new_size <= slab_class_size[tag]) {
+        return ptr;
+    }
+    void *fresh = slab_alloc(new_size, ctx);
+    if (!fresh) return NULL;
+    int64_t copy = old_size < new_size ? old_size : new_size;
+    if (copy > 0) memcpy(fresh, ptr, (size_t)copy);
+    slab_free(ptr, ctx);
+    return fresh;
+}
+
+void rask_slab_allocator(RaskAllocator *out) {
+    out->alloc   = slab_alloc;
+    out->realloc = slab_realloc;
+    out->free    = slab_free;
+    out->ctx     = NULL;
+}
+
+// ─── Arena backend ─────────────────────────────────────────
+//
+// Bump allocator over a chain of chunks. free() is a no-op; memory is
+// reclaimed by popping a scope (rask_arena_scope_begin/end) or freeing
+// the whole arena. Meant for request-shaped workloads: install via
+// rask_arena_allocator() + rask_allocator_set(), open a scope per
+// request, pop it when the response is out.
+//
+// Arena internals allocate with malloc directly — the arena may be the
+// active allocator, so going through rask_alloc would recurse.
+
+typedef struct ArenaChunk {
+    struct ArenaChunk *next;  // older chunk
+    int64_t cap;
+    int64_t used;
+    // data follows, 16-byte aligned
+} ArenaChunk;
+
+#define ARENA_ALIGN 16
+#define ARENA_HEADER ((int64_t)((sizeof(ArenaChunk) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1)))
+#define ARENA_SCOPE_MAX 64
+
+typedef struct {
+    ArenaChunk *chunk;
+    int64_t     used;
+} ArenaMark;
+
+struct RaskArena {
+    ArenaChunk *head;          // current chunk (newest)
+    int64_t     chunk_size;    // payload size for new chunks
+    ArenaMark   scopes[ARENA_SCOPE_MAX];
+    int32_t     scope_depth;
+};
+
+static ArenaChunk *arena_chunk_new(int64_t payload) {
+    ArenaChunk *c = (ArenaChunk *)malloc((size_t)(ARENA_HEADER + payload));
+    if (!c) {
+        fprintf(stderr, "rask: arena chunk allocation failed (%lld bytes)\n",
+                (long long)payload);
+        abort();
+    }
+    c->next = NULL;
+    c->cap = payload;
+    c->used = 0;
+    return c;
+}
+
+RaskArena *rask_arena_new(int64_t chunk_size) {
+    if (chunk_size <= 0) chunk_size = 64 * 1024;
+    RaskArena *a = (RaskArena *)malloc(sizeof(RaskArena));
+    if (!a) {
+        fprintf(stderr, "rask: arena allocation failed\n");
+        abort();
+    }
+    a->chunk_size = chunk_size;
+    a->head = arena_chunk_new(chunk_size);
+    a->scope_depth = 0;
+    return a;
+}
+
+void rask_arena_destroy(RaskArena *a) {
+    if (!a) return;
+    ArenaChunk *c = a->head;
+    while (c) {
+        ArenaChunk *next = c->next;
+        free(c);
+        c = next;
+    }
+    free(a);
+}
+
+static void *arena_alloc(int64_t size, void *ctx) {
+    RaskArena *a = (RaskArena *)ctx;
+    int64_t aligned = (size + ARENA_ALIGN - 1) & ~(int64_t)(ARENA_ALIGN - 1);
+    ArenaChunk *c = a->head;
+    if (c->used + aligned > c->cap) {
+        // Oversized requests get their own chunk so chunk_size stays a
+        // tuning knob, not a limit.
+        int64_t payload = aligned > a->chunk_size ? aligned : a->chunk_size;
+        ArenaChunk *fresh = arena_chunk_new(payload);
+        fresh->next = c;
+        a->head = fresh;
+        c = fresh;
+    }
+    void *ptr = (char *)c + ARENA_HEADER + c->used;
+    c->used += aligned;
+    return ptr;
+}
+
+static void *arena_realloc(void *ptr, int64_t old_size, int64_t new_size, void *ctx) {
+    if (new_size <= old_size) return ptr;
+    void *fresh = arena_alloc(new_size, ctx);
+    if (ptr && old_size > 0) memcpy(fresh, ptr, (size_t)old_size);
+    return fresh;
+}
+
+static void arena_free(void *ptr, void *ctx) {
+    // Bump allocator: individual frees are no-ops. Scope pop reclaims.
+    (void)ptr;
+    (void)ctx;
+}
+
+void rask_arena_allocator(RaskArena *a, RaskAllocator *out) {
+    out->alloc   = arena_alloc;
+    out->realloc = arena_realloc;
+    out->free    = arena_free;
+    out->ctx     = a;
+}
+
+void rask_arena_scope_begin(RaskArena *a) {
+    if (a->scope_depth >= ARENA_SCOPE_MAX) {
+        rask_panic("arena scope depth exceeded");
+    }
+    a->scopes[a->scope_depth].chunk = a->head;
+    a->scopes[a->scope_depth].used = a->head->used;
+    a->scope_depth++;
+}
+
+void rask_arena_scope_end(RaskArena *a) {
+    if (a->scope_depth <= 0) {
+        rask_panic("arena scope end without begin");
+    }
+    a->scope_depth--;
+    ArenaMark mark = a->scopes[a->scope_depth];
+    // Free chunks newer than the mark, then rewind the bump pointer.
+    ArenaChunk *c = a->head;
+    while (c != mark.chunk) {
+        ArenaChunk *next = c->next;
+        free(c);
+        c = next;
+    }
+    a->head = c;
+    c->used = mark.used;
+}
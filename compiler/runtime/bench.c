@@ -2,18 +2,38 @@
 
 // Rask benchmark harness — warmup, calibrate, measure, report.
 // Called from generated benchmark runner entry points.
+//
+// Each benchmark reports one JSON line with wall-clock stats (min/max/
+// mean/median/MAD), allocation deltas per iteration, and — on Linux,
+// when perf_event_open is permitted — hardware counters averaged per
+// iteration. MAD (median absolute deviation) is the spread measure to
+// trust: unlike mean/max it ignores the occasional preempted iteration.
+//
+// Baseline compare: set RASK_BENCH_BASELINE to a JSON file of previous
+// results (either this harness's JSONL output or a suite --save file).
+// Benchmarks whose median regresses more than RASK_BENCH_THRESHOLD
+// (default 0.05 = 5%) are flagged on stderr and the process exits
+// nonzero after the run completes.
 
 #include "rask_runtime.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 typedef void (*bench_fn)(void);
 
+// Fast clock keeps the per-iteration timestamp pair cheap relative to
+// small benchmark bodies; falls back to clock_gettime off x86.
 static int64_t clock_ns(void) {
-    struct timespec ts;
-    clock_gettime(CLOCK_MONOTONIC, &ts);
-    return (int64_t)ts.tv_sec * 1000000000LL + (int64_t)ts.tv_nsec;
+    return rask_time_Instant_now_fast();
 }
 
 static int cmp_i64(const void *a, const void *b) {
@@ -22,8 +42,153 @@ static int cmp_i64(const void *a, const void *b) {
     return (va > vb) - (va < vb);
 }
 
+// ─── Hardware counters ────────────────────────────────────────────
+
+#define BENCH_NCOUNTERS 4
+
+static const char *bench_counter_keys[BENCH_NCOUNTERS] = {
+    "instructions", "cycles", "cache_misses", "branch_misses",
+};
+
+#ifdef __linux__
+static const uint64_t bench_counter_configs[BENCH_NCOUNTERS] = {
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+// Open one fd per event, disabled, user-space only. Kernels without
+// perf, or containers with perf_event_paranoid locked down, fail the
+// first open — then we just report wall-clock and alloc stats.
+static int bench_counters_open(int fds[BENCH_NCOUNTERS]) {
+    for (int i = 0; i < BENCH_NCOUNTERS; i++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = bench_counter_configs[i];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fds[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        if (fds[i] < 0) {
+            for (int j = 0; j < i; j++) close(fds[j]);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void bench_counters_start(int fds[BENCH_NCOUNTERS]) {
+    for (int i = 0; i < BENCH_NCOUNTERS; i++) {
+        ioctl(fds[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+static void bench_counters_stop(int fds[BENCH_NCOUNTERS],
+                                uint64_t vals[BENCH_NCOUNTERS]) {
+    for (int i = 0; i < BENCH_NCOUNTERS; i++) {
+        ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fds[i], &vals[i], sizeof(uint64_t)) != sizeof(uint64_t))
+            vals[i] = 0;
+        close(fds[i]);
+    }
+}
+#endif
+
+// ─── Baseline compare ─────────────────────────────────────────────
+
+struct BenchBaseline {
+    char name[128];
+    int64_t median_ns;
+};
+
+static struct BenchBaseline *baseline_entries;
+static int baseline_count = -1; // -1 = not loaded yet
+static double baseline_threshold = 0.05;
+static int bench_regressions;
+
+static int64_t baseline_scan_i64(const char *line, const char *pat) {
+    const char *p = strstr(line, pat);
+    if (!p) return -1;
+    return strtoll(p + strlen(pat), NULL, 10);
+}
+
+// Accepts both this harness's JSONL output ("median_ns") and the suite
+// --save format ("rask_median_ns"), one object per line.
+static void bench_baseline_load(void) {
+    baseline_count = 0;
+    const char *path = getenv("RASK_BENCH_BASELINE");
+    if (!path) return;
+    const char *thresh = getenv("RASK_BENCH_THRESHOLD");
+    if (thresh) {
+        double t = strtod(thresh, NULL);
+        if (t > 0.0) baseline_threshold = t;
+    }
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "bench: cannot open baseline %s\n", path);
+        return;
+    }
+    int cap = 16;
+    baseline_entries = (struct BenchBaseline *)malloc(
+        (size_t)cap * sizeof(struct BenchBaseline));
+    char line[512];
+    while (baseline_entries && fgets(line, sizeof(line), f)) {
+        const char *np = strstr(line, "\"name\":\"");
+        if (!np) continue;
+        np += 8;
+        const char *ne = strchr(np, '"');
+        if (!ne || ne - np >= 128) continue;
+        int64_t med = baseline_scan_i64(line, "\"rask_median_ns\":");
+        if (med < 0) med = baseline_scan_i64(line, "\"median_ns\":");
+        if (med <= 0) continue;
+        if (baseline_count == cap) {
+            cap *= 2;
+            baseline_entries = (struct BenchBaseline *)realloc(
+                baseline_entries, (size_t)cap * sizeof(struct BenchBaseline));
+            if (!baseline_entries) break;
+        }
+        memcpy(baseline_entries[baseline_count].name, np, (size_t)(ne - np));
+        baseline_entries[baseline_count].name[ne - np] = '\0';
+        baseline_entries[baseline_count].median_ns = med;
+        baseline_count++;
+    }
+    fclose(f);
+}
+
+static const struct BenchBaseline *bench_baseline_find(const char *name) {
+    for (int i = 0; i < baseline_count; i++) {
+        if (strcmp(baseline_entries[i].name, name) == 0)
+            return &baseline_entries[i];
+    }
+    return NULL;
+}
+
+// Called from the entry point after rask_main returns, so a regression
+// anywhere in the suite fails the process after all benchmarks have
+// reported. Not an atexit handler: _Exit from one would skip later
+// handlers (the alloc profiler dump), and atexit can't set the status
+// any other way. Returning the status through main lets exit run them.
+int rask_bench_failed(void) {
+    if (bench_regressions > 0) {
+        fprintf(stderr, "bench: %d benchmark(s) regressed more than %.1f%%\n",
+                bench_regressions, baseline_threshold * 100.0);
+        return 1;
+    }
+    return 0;
+}
+
+// ─── Harness ──────────────────────────────────────────────────────
+
 // Run a benchmark: warmup, auto-calibrate iterations, measure, print JSON line.
 void rask_bench_run(bench_fn fn, const char *name) {
+    if (baseline_count < 0) {
+        bench_baseline_load();
+    }
+
     // Warmup: 3 iterations
     for (int i = 0; i < 3; i++) {
         fn();
@@ -43,7 +208,7 @@ void rask_bench_run(bench_fn fn, const char *name) {
         iterations *= 2;
     }
 
-    // Measure each iteration
+    // Measure each iteration; counters and alloc stats bracket the loop
     int64_t *timings = (int64_t *)malloc((size_t)iterations * sizeof(int64_t));
     if (!timings) {
         fprintf(stderr, "bench: allocation failed for %lld timings\n",
@@ -51,12 +216,28 @@ void rask_bench_run(bench_fn fn, const char *name) {
         return;
     }
 
+    int have_counters = 0;
+    uint64_t counter_vals[BENCH_NCOUNTERS] = {0};
+#ifdef __linux__
+    int counter_fds[BENCH_NCOUNTERS];
+    have_counters = bench_counters_open(counter_fds);
+    if (have_counters) bench_counters_start(counter_fds);
+#endif
+    RaskAllocStats alloc_before;
+    rask_alloc_stats(&alloc_before);
+
     for (int64_t i = 0; i < iterations; i++) {
         int64_t start = clock_ns();
         fn();
         timings[i] = clock_ns() - start;
     }
 
+    RaskAllocStats alloc_after;
+    rask_alloc_stats(&alloc_after);
+#ifdef __linux__
+    if (have_counters) bench_counters_stop(counter_fds, counter_vals);
+#endif
+
     // Stats
     qsort(timings, (size_t)iterations, sizeof(int64_t), cmp_i64);
 
@@ -70,15 +251,54 @@ void rask_bench_run(bench_fn fn, const char *name) {
     int64_t mean_ns   = total / iterations;
     int64_t median_ns = timings[iterations / 2];
 
+    // MAD: median of |t - median|; reuses the sorted buffer
+    for (int64_t i = 0; i < iterations; i++) {
+        int64_t d = timings[i] - median_ns;
+        timings[i] = d < 0 ? -d : d;
+    }
+    qsort(timings, (size_t)iterations, sizeof(int64_t), cmp_i64);
+    int64_t mad_ns = timings[iterations / 2];
+
     free(timings);
 
     printf("{\"name\":\"%s\",\"iterations\":%lld,\"min_ns\":%lld,"
-           "\"max_ns\":%lld,\"mean_ns\":%lld,\"median_ns\":%lld}\n",
+           "\"max_ns\":%lld,\"mean_ns\":%lld,\"median_ns\":%lld,"
+           "\"mad_ns\":%lld",
            name,
            (long long)iterations,
            (long long)min_ns,
            (long long)max_ns,
            (long long)mean_ns,
-           (long long)median_ns);
+           (long long)median_ns,
+           (long long)mad_ns);
+
+    // Allocation deltas, averaged per iteration
+    printf(",\"allocs_per_iter\":%lld,\"alloc_bytes_per_iter\":%lld",
+           (long long)((alloc_after.alloc_count - alloc_before.alloc_count)
+                       / iterations),
+           (long long)((alloc_after.bytes_allocated - alloc_before.bytes_allocated)
+                       / iterations));
+
+    if (have_counters) {
+        for (int i = 0; i < BENCH_NCOUNTERS; i++) {
+            printf(",\"%s\":%lld", bench_counter_keys[i],
+                   (long long)(counter_vals[i] / (uint64_t)iterations));
+        }
+    }
+
+    const struct BenchBaseline *base = bench_baseline_find(name);
+    if (base) {
+        double pct = ((double)median_ns / (double)base->median_ns - 1.0) * 100.0;
+        printf(",\"vs_baseline_pct\":%.1f", pct);
+        if (pct > baseline_threshold * 100.0) {
+            printf(",\"regressed\":true");
+            fprintf(stderr,
+                    "bench: %s regressed %+.1f%% (median %lld ns -> %lld ns)\n",
+                    name, pct, (long long)base->median_ns, (long long)median_ns);
+            bench_regressions++;
+        }
+    }
+
+    printf("}\n");
     fflush(stdout);
 }
@@ -5,13 +5,20 @@
 // Based on conc.async/CH1-CH4:
 //   - Sender/Receiver are non-linear (can be dropped without close)
 //   - Close-on-drop when refcount hits zero
-//   - Buffered: ring buffer with capacity N
+//   - Buffered: lock-free ring (per-slot sequence numbers, CAS positions)
+//     with futex parking only when full/empty
 //   - Unbuffered (capacity=0): direct handoff (sender blocks until receiver)
 //
 // Both halves share a RaskChannel through refcounting. Senders and receivers
 // each have their own refcount. When all senders drop, receivers see CLOSED.
 // When all receivers drop, senders see CLOSED.
 
+#ifdef __linux__
+// syscall() and the futex constants sit behind the glibc extras under
+// the Makefile's -std=c11 -D_POSIX_C_SOURCE flags.
+#define _DEFAULT_SOURCE
+#endif
+
 #include "rask_runtime.h"
 
 #include <stdlib.h>
@@ -19,22 +26,90 @@
 #include <string.h>
 #include <pthread.h>
 #include <stdatomic.h>
+#include <limits.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
+// ─── Parking ───────────────────────────────────────────────
+//
+// Waiters register in a waiting counter, re-check, then park on a seq
+// word; wakers bump the seq before waking, so a wake issued before the
+// wait lands is still seen — the parked side finds the word changed
+// and returns instead of sleeping. No timeout: the protocol, not a
+// backstop, guarantees delivery.
+
+#ifdef __linux__
+
+static void chan_futex_wait(_Atomic uint32_t *addr, uint32_t expect) {
+    syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, expect, NULL, NULL, 0);
+}
+
+static void chan_futex_wake(_Atomic uint32_t *addr, int n) {
+    syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, n, NULL, NULL, 0);
+}
+
+#else
+
+// Portable fallback (macOS): one mutex/condvar pair stands in for the
+// futex. The lock serializes check-then-sleep against the waker's seq
+// bump; broadcast because the pair is shared across channels.
+static pthread_mutex_t chan_park_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  chan_park_cond  = PTHREAD_COND_INITIALIZER;
+
+static void chan_futex_wait(_Atomic uint32_t *addr, uint32_t expect) {
+    pthread_mutex_lock(&chan_park_mutex);
+    if (atomic_load_explicit(addr, memory_order_acquire) == expect) {
+        pthread_cond_wait(&chan_park_cond, &chan_park_mutex);
+    }
+    pthread_mutex_unlock(&chan_park_mutex);
+}
+
+static void chan_futex_wake(_Atomic uint32_t *addr, int n) {
+    (void)addr; (void)n;
+    pthread_mutex_lock(&chan_park_mutex);
+    pthread_mutex_unlock(&chan_park_mutex);
+    pthread_cond_broadcast(&chan_park_cond);
+}
+
+#endif
 
 // ─── Channel internals ─────────────────────────────────────
 
 struct RaskChannel {
-    // Shared state
+    // Rendezvous state (unbuffered only)
     pthread_mutex_t mutex;
     pthread_cond_t  not_full;
     pthread_cond_t  not_empty;
 
-    // Ring buffer
-    void   *buffer;          // NULL for unbuffered
     int64_t elem_size;
     int64_t capacity;        // 0 = unbuffered
-    int64_t head;            // next read position
-    int64_t tail;            // next write position
-    int64_t count;           // items in buffer
+
+    // Pointer-transfer mode (large buffered elements): the ring carries an
+    // owning pointer instead of inline bytes. Copy-API entry points box the
+    // value once at send; the owned API moves it with no copy at all.
+    int   indirect;
+    void (*elem_drop)(void *); // cleanup for values stranded at destroy
+
+    // Lock-free ring (buffered): each slot is {u64 sequence} + payload.
+    // Vyukov bounded MPMC — slot seq == pos means free for the producer
+    // claiming pos; seq == pos+1 means filled for the consumer at pos.
+    // ring_elem is the in-slot payload size: elem_size inline, 8 indirect.
+    char            *slots;
+    int64_t          ring_elem;
+    int64_t          slot_stride;
+    _Atomic uint64_t enqueue_pos;
+    _Atomic uint64_t dequeue_pos;
+
+    // Futex parking (buffered): waiter counts let the fast path skip the
+    // wake syscall; the seq words are the futex values.
+    atomic_int       send_waiting;
+    atomic_int       recv_waiting;
+    _Atomic uint32_t not_full_seq;
+    _Atomic uint32_t not_empty_seq;
+    atomic_int       closed_flag;  // buffered close (no mutex involved)
 
     // Unbuffered handoff slot
     const void *handoff_data;  // pointer to sender's data (unbuffered only)
@@ -44,9 +119,14 @@ struct RaskChannel {
     // Lifecycle
     atomic_int sender_count;
     atomic_int recver_count;
-    int        closed;       // protected by mutex
+    int        closed;       // protected by mutex (unbuffered)
 };
 
+#define SLOT_SEQ(ch, i) \
+    ((_Atomic uint64_t *)((ch)->slots + (i) * (ch)->slot_stride))
+#define SLOT_DATA(ch, i) \
+    ((ch)->slots + (i) * (ch)->slot_stride + sizeof(uint64_t))
+
 struct RaskSender {
     RaskChannel *chan;
 };
@@ -65,15 +145,28 @@ static RaskChannel *channel_alloc(int64_t elem_size, int64_t capacity) {
 
     ch->elem_size = elem_size;
     ch->capacity  = capacity;
-    ch->head = ch->tail = ch->count = 0;
     ch->handoff_data  = NULL;
     ch->handoff_ready = 0;
     ch->handoff_taken = 0;
 
     if (capacity > 0) {
-        int64_t buf_size = capacity * elem_size;
-        ch->buffer = rask_alloc(buf_size);
-        memset(ch->buffer, 0, (size_t)buf_size);
+        ch->indirect  = elem_size > RASK_CHAN_INDIRECT_THRESHOLD;
+        ch->elem_drop = rask_free;
+        ch->ring_elem = ch->indirect ? (int64_t)sizeof(void *) : elem_size;
+        // Seq word + payload, payload 8-aligned within the slot
+        ch->slot_stride = (int64_t)sizeof(uint64_t) + ((ch->ring_elem + 7) & ~7);
+        ch->slots = rask_alloc(capacity * ch->slot_stride);
+        memset(ch->slots, 0, (size_t)(capacity * ch->slot_stride));
+        for (int64_t i = 0; i < capacity; i++) {
+            atomic_init(SLOT_SEQ(ch, i), (uint64_t)i);
+        }
+        atomic_init(&ch->enqueue_pos, 0);
+        atomic_init(&ch->dequeue_pos, 0);
+        atomic_init(&ch->send_waiting, 0);
+        atomic_init(&ch->recv_waiting, 0);
+        atomic_init(&ch->not_full_seq, 0);
+        atomic_init(&ch->not_empty_seq, 0);
+        atomic_init(&ch->closed_flag, 0);
     }
 
     atomic_init(&ch->sender_count, 1);
@@ -87,7 +180,20 @@ static void channel_destroy(RaskChannel *ch) {
     pthread_mutex_destroy(&ch->mutex);
     pthread_cond_destroy(&ch->not_full);
     pthread_cond_destroy(&ch->not_empty);
-    rask_free(ch->buffer);
+    if (ch->indirect) {
+        // Both sides gone, so no concurrency — drop values stranded in the ring
+        uint64_t deq = atomic_load_explicit(&ch->dequeue_pos, memory_order_relaxed);
+        uint64_t enq = atomic_load_explicit(&ch->enqueue_pos, memory_order_relaxed);
+        for (uint64_t pos = deq; pos != enq; pos++) {
+            int64_t idx = (int64_t)(pos % (uint64_t)ch->capacity);
+            if (atomic_load_explicit(SLOT_SEQ(ch, idx), memory_order_relaxed) == pos + 1) {
+                void *block;
+                memcpy(&block, SLOT_DATA(ch, idx), sizeof(block));
+                ch->elem_drop(block);
+            }
+        }
+    }
+    rask_free(ch->slots);
     rask_free(ch);
 }
 
@@ -100,107 +206,283 @@ static void channel_maybe_destroy(RaskChannel *ch) {
     }
 }
 
-// ─── Buffered operations ───────────────────────────────────
-
-static int64_t buffered_send(RaskChannel *ch, const void *data) {
-    pthread_mutex_lock(&ch->mutex);
-
-    while (ch->count >= ch->capacity && !ch->closed) {
-        // Check if all receivers are gone
-        if (atomic_load_explicit(&ch->recver_count, memory_order_acquire) == 0) {
-            ch->closed = 1;
-            break;
-        }
-        pthread_cond_wait(&ch->not_full, &ch->mutex);
-    }
-
-    if (ch->closed ||
+// ─── Buffered operations (lock-free ring) ──────────────────
+//
+// The common path — many senders feeding one receiver at high rates — never
+// touches the mutex. Producers claim positions with a CAS on enqueue_pos;
+// per-slot sequence numbers order the claim against the consumer, so a slot
+// is never read before its write completes. Parking happens only on the
+// full/empty edges, via futex on the not_full/not_empty words.
+
+static int64_t ring_try_send(RaskChannel *ch, const void *data) {
+    if (atomic_load_explicit(&ch->closed_flag, memory_order_acquire) ||
         atomic_load_explicit(&ch->recver_count, memory_order_acquire) == 0) {
-        pthread_mutex_unlock(&ch->mutex);
         return RASK_CHAN_CLOSED;
     }
 
-    char *slot = (char *)ch->buffer + ch->tail * ch->elem_size;
-    memcpy(slot, data, (size_t)ch->elem_size);
-    ch->tail = (ch->tail + 1) % ch->capacity;
-    ch->count++;
-
-    pthread_cond_signal(&ch->not_empty);
-    pthread_mutex_unlock(&ch->mutex);
-    return RASK_CHAN_OK;
+    uint64_t pos = atomic_load_explicit(&ch->enqueue_pos, memory_order_relaxed);
+    for (;;) {
+        _Atomic uint64_t *seq_p = SLOT_SEQ(ch, (int64_t)(pos % (uint64_t)ch->capacity));
+        uint64_t seq = atomic_load_explicit(seq_p, memory_order_acquire);
+        int64_t  dif = (int64_t)(seq - pos);
+
+        if (dif == 0) {
+            // Slot free — claim the position
+            if (atomic_compare_exchange_weak_explicit(&ch->enqueue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                memcpy(SLOT_DATA(ch, (int64_t)(pos % (uint64_t)ch->capacity)),
+                       data, (size_t)ch->ring_elem);
+                atomic_store_explicit(seq_p, pos + 1, memory_order_release);
+                // Publish before the waiter check (pairs with the fence in ring_recv)
+                atomic_thread_fence(memory_order_seq_cst);
+                if (atomic_load_explicit(&ch->recv_waiting, memory_order_relaxed) > 0) {
+                    atomic_fetch_add_explicit(&ch->not_empty_seq, 1, memory_order_release);
+                    chan_futex_wake(&ch->not_empty_seq, 1);
+                }
+                return RASK_CHAN_OK;
+            }
+            // CAS failed — pos reloaded, retry
+        } else if (dif < 0) {
+            // Consumer hasn't freed this slot yet: ring is full
+            return RASK_CHAN_FULL;
+        } else {
+            pos = atomic_load_explicit(&ch->enqueue_pos, memory_order_relaxed);
+        }
+    }
 }
 
-static int64_t buffered_recv(RaskChannel *ch, void *data_out) {
-    pthread_mutex_lock(&ch->mutex);
+static int64_t ring_try_recv(RaskChannel *ch, void *data_out) {
+    uint64_t pos = atomic_load_explicit(&ch->dequeue_pos, memory_order_relaxed);
+    for (;;) {
+        _Atomic uint64_t *seq_p = SLOT_SEQ(ch, (int64_t)(pos % (uint64_t)ch->capacity));
+        uint64_t seq = atomic_load_explicit(seq_p, memory_order_acquire);
+        int64_t  dif = (int64_t)(seq - (pos + 1));
+
+        if (dif == 0) {
+            if (atomic_compare_exchange_weak_explicit(&ch->dequeue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                memcpy(data_out,
+                       SLOT_DATA(ch, (int64_t)(pos % (uint64_t)ch->capacity)),
+                       (size_t)ch->ring_elem);
+                // Free the slot for the producer one lap ahead
+                atomic_store_explicit(seq_p, pos + (uint64_t)ch->capacity,
+                                      memory_order_release);
+                atomic_thread_fence(memory_order_seq_cst);
+                if (atomic_load_explicit(&ch->send_waiting, memory_order_relaxed) > 0) {
+                    atomic_fetch_add_explicit(&ch->not_full_seq, 1, memory_order_release);
+                    chan_futex_wake(&ch->not_full_seq, 1);
+                }
+                return RASK_CHAN_OK;
+            }
+        } else if (dif < 0) {
+            // Slot not written yet: ring is empty. Closed only matters once
+            // drained — pending items stay receivable after the last sender drops.
+            if (atomic_load_explicit(&ch->closed_flag, memory_order_acquire) ||
+                atomic_load_explicit(&ch->sender_count, memory_order_acquire) == 0) {
+                return RASK_CHAN_CLOSED;
+            }
+            return RASK_CHAN_EMPTY;
+        } else {
+            pos = atomic_load_explicit(&ch->dequeue_pos, memory_order_relaxed);
+        }
+    }
+}
 
-    while (ch->count == 0) {
-        // Empty — check if senders are gone
-        if (atomic_load_explicit(&ch->sender_count, memory_order_acquire) == 0) {
-            pthread_mutex_unlock(&ch->mutex);
-            return RASK_CHAN_CLOSED;
+static int64_t ring_send(RaskChannel *ch, const void *data) {
+    for (;;) {
+        int64_t status = ring_try_send(ch, data);
+        if (status != RASK_CHAN_FULL) {
+            return status;
         }
-        if (ch->closed) {
-            pthread_mutex_unlock(&ch->mutex);
-            return RASK_CHAN_CLOSED;
+        // Full — register as waiter, recheck, then park. The paired seq_cst
+        // fences (here and in ring_try_recv's wake path) close the window
+        // where a consumer frees a slot but sees no waiter: either the
+        // recheck sees the free slot or the consumer sees the waiter.
+        uint32_t seq = atomic_load_explicit(&ch->not_full_seq, memory_order_acquire);
+        atomic_fetch_add_explicit(&ch->send_waiting, 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        status = ring_try_send(ch, data);
+        if (status != RASK_CHAN_FULL) {
+            atomic_fetch_sub_explicit(&ch->send_waiting, 1, memory_order_relaxed);
+            return status;
         }
-        pthread_cond_wait(&ch->not_empty, &ch->mutex);
+        chan_futex_wait(&ch->not_full_seq, seq);
+        atomic_fetch_sub_explicit(&ch->send_waiting, 1, memory_order_relaxed);
     }
-
-    char *slot = (char *)ch->buffer + ch->head * ch->elem_size;
-    memcpy(data_out, slot, (size_t)ch->elem_size);
-    ch->head = (ch->head + 1) % ch->capacity;
-    ch->count--;
-
-    pthread_cond_signal(&ch->not_full);
-    pthread_mutex_unlock(&ch->mutex);
-    return RASK_CHAN_OK;
 }
 
-static int64_t buffered_try_send(RaskChannel *ch, const void *data) {
-    pthread_mutex_lock(&ch->mutex);
-
-    if (ch->closed ||
+// ─── Batched ring operations ───────────────────────────────
+//
+// One CAS claims a contiguous run of positions, then slots are filled (or
+// drained) individually — the per-slot sequence numbers already make partial
+// completion safe for the other side. Burst producers pay one synchronization
+// episode per batch instead of one per message.
+
+// Returns elements moved (0 = full) or RASK_CHAN_CLOSED.
+static int64_t ring_try_send_many(RaskChannel *ch, const void *data, int64_t count) {
+    if (atomic_load_explicit(&ch->closed_flag, memory_order_acquire) ||
         atomic_load_explicit(&ch->recver_count, memory_order_acquire) == 0) {
-        pthread_mutex_unlock(&ch->mutex);
         return RASK_CHAN_CLOSED;
     }
 
-    if (ch->count >= ch->capacity) {
-        pthread_mutex_unlock(&ch->mutex);
-        return RASK_CHAN_FULL;
+    for (;;) {
+        uint64_t pos = atomic_load_explicit(&ch->enqueue_pos, memory_order_relaxed);
+        int64_t n = 0;
+        while (n < count && n < ch->capacity) {
+            _Atomic uint64_t *seq_p =
+                SLOT_SEQ(ch, (int64_t)((pos + (uint64_t)n) % (uint64_t)ch->capacity));
+            uint64_t seq = atomic_load_explicit(seq_p, memory_order_acquire);
+            int64_t  dif = (int64_t)(seq - (pos + (uint64_t)n));
+            if (dif > 0) goto restart; // stale pos — another producer moved on
+            if (dif < 0) break;        // slot still held by the consumer: full here
+            n++;
+        }
+        if (n == 0) {
+            return 0;
+        }
+        uint64_t expect = pos;
+        if (!atomic_compare_exchange_weak_explicit(&ch->enqueue_pos, &expect,
+                                                   pos + (uint64_t)n,
+                                                   memory_order_relaxed,
+                                                   memory_order_relaxed)) {
+            continue;
+        }
+        for (int64_t i = 0; i < n; i++) {
+            int64_t idx = (int64_t)((pos + (uint64_t)i) % (uint64_t)ch->capacity);
+            memcpy(SLOT_DATA(ch, idx),
+                   (const char *)data + i * ch->ring_elem,
+                   (size_t)ch->ring_elem);
+            atomic_store_explicit(SLOT_SEQ(ch, idx), pos + (uint64_t)i + 1,
+                                  memory_order_release);
+        }
+        atomic_thread_fence(memory_order_seq_cst);
+        if (atomic_load_explicit(&ch->recv_waiting, memory_order_relaxed) > 0) {
+            atomic_fetch_add_explicit(&ch->not_empty_seq, 1, memory_order_release);
+            chan_futex_wake(&ch->not_empty_seq, 1);
+        }
+        return n;
+    restart:;
     }
+}
 
-    char *slot = (char *)ch->buffer + ch->tail * ch->elem_size;
-    memcpy(slot, data, (size_t)ch->elem_size);
-    ch->tail = (ch->tail + 1) % ch->capacity;
-    ch->count++;
+// Returns elements moved (0 = empty) or RASK_CHAN_CLOSED (empty and closed).
+static int64_t ring_try_recv_many(RaskChannel *ch, void *out, int64_t max) {
+    for (;;) {
+        uint64_t pos = atomic_load_explicit(&ch->dequeue_pos, memory_order_relaxed);
+        int64_t n = 0;
+        while (n < max && n < ch->capacity) {
+            _Atomic uint64_t *seq_p =
+                SLOT_SEQ(ch, (int64_t)((pos + (uint64_t)n) % (uint64_t)ch->capacity));
+            uint64_t seq = atomic_load_explicit(seq_p, memory_order_acquire);
+            int64_t  dif = (int64_t)(seq - (pos + (uint64_t)n + 1));
+            if (dif > 0) goto restart;
+            if (dif < 0) break; // slot not written yet: empty past here
+            n++;
+        }
+        if (n == 0) {
+            if (atomic_load_explicit(&ch->closed_flag, memory_order_acquire) ||
+                atomic_load_explicit(&ch->sender_count, memory_order_acquire) == 0) {
+                return RASK_CHAN_CLOSED;
+            }
+            return 0;
+        }
+        uint64_t expect = pos;
+        if (!atomic_compare_exchange_weak_explicit(&ch->dequeue_pos, &expect,
+                                                   pos + (uint64_t)n,
+                                                   memory_order_relaxed,
+                                                   memory_order_relaxed)) {
+            continue;
+        }
+        for (int64_t i = 0; i < n; i++) {
+            int64_t idx = (int64_t)((pos + (uint64_t)i) % (uint64_t)ch->capacity);
+            memcpy((char *)out + i * ch->ring_elem, SLOT_DATA(ch, idx),
+                   (size_t)ch->ring_elem);
+            atomic_store_explicit(SLOT_SEQ(ch, idx),
+                                  pos + (uint64_t)i + (uint64_t)ch->capacity,
+                                  memory_order_release);
+        }
+        atomic_thread_fence(memory_order_seq_cst);
+        if (atomic_load_explicit(&ch->send_waiting, memory_order_relaxed) > 0) {
+            atomic_fetch_add_explicit(&ch->not_full_seq, 1, memory_order_release);
+            chan_futex_wake(&ch->not_full_seq, n > INT_MAX ? INT_MAX : (int)n);
+        }
+        return n;
+    restart:;
+    }
+}
 
-    pthread_cond_signal(&ch->not_empty);
-    pthread_mutex_unlock(&ch->mutex);
-    return RASK_CHAN_OK;
+static int64_t ring_recv(RaskChannel *ch, void *data_out) {
+    for (;;) {
+        int64_t status = ring_try_recv(ch, data_out);
+        if (status != RASK_CHAN_EMPTY) {
+            return status;
+        }
+        uint32_t seq = atomic_load_explicit(&ch->not_empty_seq, memory_order_acquire);
+        atomic_fetch_add_explicit(&ch->recv_waiting, 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        status = ring_try_recv(ch, data_out);
+        if (status != RASK_CHAN_EMPTY) {
+            atomic_fetch_sub_explicit(&ch->recv_waiting, 1, memory_order_relaxed);
+            return status;
+        }
+        chan_futex_wait(&ch->not_empty_seq, seq);
+        atomic_fetch_sub_explicit(&ch->recv_waiting, 1, memory_order_relaxed);
+    }
 }
 
-static int64_t buffered_try_recv(RaskChannel *ch, void *data_out) {
-    pthread_mutex_lock(&ch->mutex);
+// ─── Pointer-transfer shims ────────────────────────────────
+//
+// Indirect channels box the value once at send (outside any shared state)
+// and hand the receiver the box contents; the ring itself only ever moves
+// 8 bytes. The owned API below skips even that one copy.
+
+static int64_t indirect_send(RaskChannel *ch, const void *data, int blocking) {
+    void *block = rask_alloc(ch->elem_size);
+    memcpy(block, data, (size_t)ch->elem_size);
+    int64_t status = blocking ? ring_send(ch, &block) : ring_try_send(ch, &block);
+    if (status != RASK_CHAN_OK) {
+        rask_free(block);
+    }
+    return status;
+}
 
-    if (ch->count == 0) {
-        int64_t result = RASK_CHAN_EMPTY;
-        if (atomic_load_explicit(&ch->sender_count, memory_order_acquire) == 0 ||
-            ch->closed) {
-            result = RASK_CHAN_CLOSED;
-        }
-        pthread_mutex_unlock(&ch->mutex);
-        return result;
+static int64_t indirect_recv(RaskChannel *ch, void *out, int blocking) {
+    void *block = NULL;
+    int64_t status = blocking ? ring_recv(ch, &block) : ring_try_recv(ch, &block);
+    if (status == RASK_CHAN_OK) {
+        memcpy(out, block, (size_t)ch->elem_size);
+        rask_free(block); // value moved out; only the box dies here
     }
+    return status;
+}
 
-    char *slot = (char *)ch->buffer + ch->head * ch->elem_size;
-    memcpy(data_out, slot, (size_t)ch->elem_size);
-    ch->head = (ch->head + 1) % ch->capacity;
-    ch->count--;
+static int64_t indirect_try_send_many(RaskChannel *ch, const void *data, int64_t count) {
+    enum { CHUNK = 64 };
+    void *ptrs[CHUNK];
+    int64_t n = count < CHUNK ? count : CHUNK;
+    for (int64_t i = 0; i < n; i++) {
+        ptrs[i] = rask_alloc(ch->elem_size);
+        memcpy(ptrs[i], (const char *)data + i * ch->elem_size, (size_t)ch->elem_size);
+    }
+    int64_t moved = ring_try_send_many(ch, ptrs, n);
+    for (int64_t i = (moved < 0 ? 0 : moved); i < n; i++) {
+        rask_free(ptrs[i]); // boxes that didn't fit
+    }
+    return moved;
+}
 
-    pthread_cond_signal(&ch->not_full);
-    pthread_mutex_unlock(&ch->mutex);
-    return RASK_CHAN_OK;
+static int64_t indirect_try_recv_many(RaskChannel *ch, void *out, int64_t max) {
+    enum { CHUNK = 64 };
+    void *ptrs[CHUNK];
+    int64_t n = max < CHUNK ? max : CHUNK;
+    int64_t moved = ring_try_recv_many(ch, ptrs, n);
+    for (int64_t i = 0; i < moved; i++) {
+        memcpy((char *)out + i * ch->elem_size, ptrs[i], (size_t)ch->elem_size);
+        rask_free(ptrs[i]);
+    }
+    return moved;
 }
 
 // ─── Unbuffered (rendezvous) operations ────────────────────
@@ -337,7 +619,7 @@ int64_t rask_channel_send(RaskSender *tx, const void *data) {
     RASK_CHECK_NONNULL(tx, "Sender.send: tx handle is null (bad channel destructure?)");
     RaskChannel *ch = tx->chan;
     if (ch->capacity > 0) {
-        return buffered_send(ch, data);
+        return ch->indirect ? indirect_send(ch, data, 1) : ring_send(ch, data);
     }
     return unbuffered_send(ch, data);
 }
@@ -346,7 +628,7 @@ int64_t rask_channel_recv(RaskRecver *rx, void *data_out) {
     RASK_CHECK_NONNULL(rx, "Receiver.recv: rx handle is null (bad channel destructure?)");
     RaskChannel *ch = rx->chan;
     if (ch->capacity > 0) {
-        return buffered_recv(ch, data_out);
+        return ch->indirect ? indirect_recv(ch, data_out, 1) : ring_recv(ch, data_out);
     }
     return unbuffered_recv(ch, data_out);
 }
@@ -355,7 +637,7 @@ int64_t rask_channel_try_send(RaskSender *tx, const void *data) {
     RASK_CHECK_NONNULL(tx, "Sender.try_send: tx handle is null");
     RaskChannel *ch = tx->chan;
     if (ch->capacity > 0) {
-        return buffered_try_send(ch, data);
+        return ch->indirect ? indirect_send(ch, data, 0) : ring_try_send(ch, data);
     }
     return unbuffered_try_send(ch, data);
 }
@@ -363,11 +645,146 @@ int64_t rask_channel_try_send(RaskSender *tx, const void *data) {
 int64_t rask_channel_try_recv(RaskRecver *rx, void *data_out) {
     RaskChannel *ch = rx->chan;
     if (ch->capacity > 0) {
-        return buffered_try_recv(ch, data_out);
+        return ch->indirect ? indirect_recv(ch, data_out, 0) : ring_try_recv(ch, data_out);
     }
     return unbuffered_try_recv(ch, data_out);
 }
 
+// ─── Batched send/recv ─────────────────────────────────────
+// One synchronization episode moves a whole run of elements. On an
+// unbuffered channel each element is still its own rendezvous.
+
+int64_t rask_channel_try_send_many(RaskSender *tx, const void *data, int64_t count) {
+    RASK_CHECK_NONNULL(tx, "Sender.try_send_many: tx handle is null");
+    if (count <= 0) {
+        return 0;
+    }
+    RaskChannel *ch = tx->chan;
+    if (ch->capacity > 0) {
+        return ch->indirect ? indirect_try_send_many(ch, data, count)
+                            : ring_try_send_many(ch, data, count);
+    }
+    // Rendezvous can't batch: a try either hands off one element or nothing
+    int64_t status = unbuffered_try_send(ch, data);
+    if (status == RASK_CHAN_CLOSED) {
+        return RASK_CHAN_CLOSED;
+    }
+    return status == RASK_CHAN_OK ? 1 : 0;
+}
+
+int64_t rask_channel_try_recv_many(RaskRecver *rx, void *out, int64_t max) {
+    RASK_CHECK_NONNULL(rx, "Receiver.try_recv_many: rx handle is null");
+    if (max <= 0) {
+        return 0;
+    }
+    RaskChannel *ch = rx->chan;
+    if (ch->capacity > 0) {
+        return ch->indirect ? indirect_try_recv_many(ch, out, max)
+                            : ring_try_recv_many(ch, out, max);
+    }
+    int64_t status = unbuffered_try_recv(ch, out);
+    if (status == RASK_CHAN_CLOSED) {
+        return RASK_CHAN_CLOSED;
+    }
+    return status == RASK_CHAN_OK ? 1 : 0;
+}
+
+int64_t rask_channel_send_many(RaskSender *tx, const void *data, int64_t count) {
+    RASK_CHECK_NONNULL(tx, "Sender.send_many: tx handle is null");
+    if (count <= 0) {
+        return 0;
+    }
+    RaskChannel *ch = tx->chan;
+    if (ch->capacity == 0) {
+        // Each element is a full handoff; stop at the first disconnect
+        for (int64_t i = 0; i < count; i++) {
+            int64_t status = unbuffered_send(ch, (const char *)data + i * ch->elem_size);
+            if (status != RASK_CHAN_OK) {
+                return i > 0 ? i : RASK_CHAN_CLOSED;
+            }
+        }
+        return count;
+    }
+    for (;;) {
+        int64_t moved = ch->indirect ? indirect_try_send_many(ch, data, count)
+                                     : ring_try_send_many(ch, data, count);
+        if (moved != 0) {
+            return moved;
+        }
+        uint32_t seq = atomic_load_explicit(&ch->not_full_seq, memory_order_acquire);
+        atomic_fetch_add_explicit(&ch->send_waiting, 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        moved = ch->indirect ? indirect_try_send_many(ch, data, count)
+                             : ring_try_send_many(ch, data, count);
+        if (moved != 0) {
+            atomic_fetch_sub_explicit(&ch->send_waiting, 1, memory_order_relaxed);
+            return moved;
+        }
+        chan_futex_wait(&ch->not_full_seq, seq);
+        atomic_fetch_sub_explicit(&ch->send_waiting, 1, memory_order_relaxed);
+    }
+}
+
+int64_t rask_channel_recv_many(RaskRecver *rx, void *out, int64_t max) {
+    RASK_CHECK_NONNULL(rx, "Receiver.recv_many: rx handle is null");
+    if (max <= 0) {
+        return 0;
+    }
+    RaskChannel *ch = rx->chan;
+    if (ch->capacity == 0) {
+        int64_t status = unbuffered_recv(ch, out);
+        return status == RASK_CHAN_OK ? 1 : RASK_CHAN_CLOSED;
+    }
+    for (;;) {
+        int64_t moved = ch->indirect ? indirect_try_recv_many(ch, out, max)
+                                     : ring_try_recv_many(ch, out, max);
+        if (moved != 0) {
+            return moved;
+        }
+        uint32_t seq = atomic_load_explicit(&ch->not_empty_seq, memory_order_acquire);
+        atomic_fetch_add_explicit(&ch->recv_waiting, 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        moved = ch->indirect ? indirect_try_recv_many(ch, out, max)
+                             : ring_try_recv_many(ch, out, max);
+        if (moved != 0) {
+            atomic_fetch_sub_explicit(&ch->recv_waiting, 1, memory_order_relaxed);
+            return moved;
+        }
+        chan_futex_wait(&ch->not_empty_seq, seq);
+        atomic_fetch_sub_explicit(&ch->recv_waiting, 1, memory_order_relaxed);
+    }
+}
+
+// ─── Owned (zero-copy) transfer ────────────────────────────
+// For pointer-transfer channels: the sender gives up an owning heap block,
+// the receiver adopts it. No payload bytes move through the ring.
+
+int64_t rask_channel_send_owned(RaskSender *tx, void *block) {
+    RASK_CHECK_NONNULL(tx, "Sender.send_owned: tx handle is null");
+    RaskChannel *ch = tx->chan;
+    if (!ch->indirect) {
+        rask_panic("send_owned on a channel without pointer-transfer mode");
+    }
+    // On CLOSED the caller keeps ownership of the block
+    return ring_send(ch, &block);
+}
+
+int64_t rask_channel_recv_owned(RaskRecver *rx, void **block_out) {
+    RASK_CHECK_NONNULL(rx, "Receiver.recv_owned: rx handle is null");
+    RaskChannel *ch = rx->chan;
+    if (!ch->indirect) {
+        rask_panic("recv_owned on a channel without pointer-transfer mode");
+    }
+    return ring_recv(ch, block_out);
+}
+
+// Cleanup hook for values stranded in a dropped channel. Defaults to
+// rask_free (the box only); codegen installs a deep drop when the element
+// owns heap payloads (Vec fields etc). NULL restores the default.
+void rask_channel_set_drop(RaskSender *tx, void (*drop_fn)(void *)) {
+    tx->chan->elem_drop = drop_fn ? drop_fn : rask_free;
+}
+
 RaskSender *rask_sender_clone(RaskSender *tx) {
     atomic_fetch_add_explicit(&tx->chan->sender_count, 1, memory_order_relaxed);
     RaskSender *clone = (RaskSender *)rask_alloc(sizeof(RaskSender));
@@ -381,10 +798,16 @@ void rask_sender_drop(RaskSender *tx) {
 
     if (atomic_fetch_sub_explicit(&ch->sender_count, 1, memory_order_acq_rel) == 1) {
         // Last sender dropped — wake any blocked receivers
-        pthread_mutex_lock(&ch->mutex);
-        ch->closed = 1;
-        pthread_cond_broadcast(&ch->not_empty);
-        pthread_mutex_unlock(&ch->mutex);
+        if (ch->capacity > 0) {
+            atomic_store_explicit(&ch->closed_flag, 1, memory_order_seq_cst);
+            atomic_fetch_add_explicit(&ch->not_empty_seq, 1, memory_order_seq_cst);
+            chan_futex_wake(&ch->not_empty_seq, INT_MAX);
+        } else {
+            pthread_mutex_lock(&ch->mutex);
+            ch->closed = 1;
+            pthread_cond_broadcast(&ch->not_empty);
+            pthread_mutex_unlock(&ch->mutex);
+        }
         channel_maybe_destroy(ch);
     }
 }
@@ -395,10 +818,16 @@ void rask_recver_drop(RaskRecver *rx) {
 
     if (atomic_fetch_sub_explicit(&ch->recver_count, 1, memory_order_acq_rel) == 1) {
         // Last receiver dropped — wake any blocked senders
-        pthread_mutex_lock(&ch->mutex);
-        ch->closed = 1;
-        pthread_cond_broadcast(&ch->not_full);
-        pthread_mutex_unlock(&ch->mutex);
+        if (ch->capacity > 0) {
+            atomic_store_explicit(&ch->closed_flag, 1, memory_order_seq_cst);
+            atomic_fetch_add_explicit(&ch->not_full_seq, 1, memory_order_seq_cst);
+            chan_futex_wake(&ch->not_full_seq, INT_MAX);
+        } else {
+            pthread_mutex_lock(&ch->mutex);
+            ch->closed = 1;
+            pthread_cond_broadcast(&ch->not_full);
+            pthread_mutex_unlock(&ch->mutex);
+        }
         channel_maybe_destroy(ch);
     }
 }
@@ -478,6 +907,19 @@ int64_t rask_channel_try_recv_i64(int64_t rx) {
     return data;
 }
 
+int64_t rask_channel_send_owned_i64(int64_t tx, int64_t block) {
+    return rask_channel_send_owned((RaskSender *)(intptr_t)tx, (void *)(intptr_t)block);
+}
+
+int64_t rask_channel_recv_owned_i64(int64_t rx) {
+    void *block = NULL;
+    int64_t status = rask_channel_recv_owned((RaskRecver *)(intptr_t)rx, &block);
+    if (status != RASK_CHAN_OK) {
+        rask_panic("recv on closed channel");
+    }
+    return (int64_t)(intptr_t)block;
+}
+
 // Non-blocking recv into a caller buffer of the element's real size. Returns
 // the status (RASK_CHAN_OK / _EMPTY / _CLOSED); codegen turns that into the
 // `T or E` Result. Unlike the _i64 form this handles elements >8 bytes and
@@ -562,6 +1004,41 @@ int64_t rask_channel_recv_async_ptr(int64_t rx, int64_t out_ptr) {
     return out_ptr;
 }
 
+// Batched async forms: move what fits, yield only when nothing moved.
+int64_t rask_channel_send_many_async(int64_t tx, int64_t data_ptr, int64_t count) {
+    if (count <= 0) {
+        return 0;
+    }
+    RaskSender *sender = (RaskSender *)(intptr_t)tx;
+    for (;;) {
+        int64_t moved = rask_channel_try_send_many(sender, (const void *)(intptr_t)data_ptr, count);
+        if (moved != 0) {
+            return moved;
+        }
+        rask_yield();
+        if (rask_green_task_is_cancelled()) {
+            return RASK_CHAN_CLOSED;
+        }
+    }
+}
+
+int64_t rask_channel_recv_many_async(int64_t rx, int64_t out_ptr, int64_t max) {
+    if (max <= 0) {
+        return 0;
+    }
+    RaskRecver *recver = (RaskRecver *)(intptr_t)rx;
+    for (;;) {
+        int64_t moved = rask_channel_try_recv_many(recver, (void *)(intptr_t)out_ptr, max);
+        if (moved != 0) {
+            return moved;
+        }
+        rask_yield();
+        if (rask_green_task_is_cancelled()) {
+            return RASK_CHAN_CLOSED;
+        }
+    }
+}
+
 int64_t rask_channel_send_async(int64_t tx, int64_t value) {
     RaskSender *sender = (RaskSender *)(intptr_t)tx;
     // Try non-blocking first
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: (MIT OR Apache-2.0)
+
+// CPU feature detection for runtime ISA dispatch.
+//
+// The runtime archive is compiled once at the baseline ISA of the build
+// machine, so kernels that benefit from wider vectors ship alternate
+// variants (built with per-function target attributes) and pick one at
+// startup. rask_cpu_init runs before rask_main, queries the hardware,
+// and re-points the kernel function pointers (rask_simd_dispatch_init).
+//
+// RASK_CPU=scalar forces the portable fallbacks — useful for A/B timing
+// and for ruling the dispatch layer out when debugging a kernel.
+
+#include "rask_runtime.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static int64_t cpu_features = 0;
+static int     cpu_inited   = 0;
+
+void rask_cpu_init(void) {
+    if (cpu_inited) return;
+    cpu_inited = 1;
+
+    const char *env = getenv("RASK_CPU");
+    if (env && strcmp(env, "scalar") == 0) {
+        rask_simd_dispatch_init();
+        return;
+    }
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))    cpu_features |= RASK_CPU_AVX2;
+    if (__builtin_cpu_supports("fma"))     cpu_features |= RASK_CPU_FMA;
+    if (__builtin_cpu_supports("avx512f")) cpu_features |= RASK_CPU_AVX512F;
+#elif defined(__aarch64__)
+    // NEON is architecturally guaranteed on aarch64.
+    cpu_features |= RASK_CPU_NEON;
+#endif
+
+    rask_simd_dispatch_init();
+}
+
+int64_t rask_cpu_features(void) {
+    return cpu_features;
+}
+
+int rask_cpu_has(int64_t feature) {
+    return (cpu_features & feature) != 0;
+}
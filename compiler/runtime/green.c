@@ -25,6 +25,8 @@
 #include <unistd.h>
 #include <sched.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
 #include <errno.h>
 
 // ─── Constants ──────────────────────────────────────────────
@@ -40,6 +42,23 @@
 #define DEQUE_CAP 1024
 #define MAX_EVENTS_PER_POLL 64
 
+// Fiber stacks: 1MB of virtual address space plus a guard page at the low
+// end. Physical pages are committed lazily by the kernel as the stack grows.
+#define FIBER_STACK_SIZE (1 << 20)
+
+// Blocking-call pool threads (lazy-spawned, shared by all fibers)
+#define BLOCKING_POOL_MAX 16
+
+// Deferred scheduler actions a suspending fiber hands to its worker
+#define FIBER_OP_NONE     0
+#define FIBER_OP_YIELD    1
+#define FIBER_OP_TIMEOUT  2
+#define FIBER_OP_READ     3
+#define FIBER_OP_WRITE    4
+#define FIBER_OP_WRITEV   5
+#define FIBER_OP_ACCEPT   6
+#define FIBER_OP_BLOCKING 7
+
 // ─── Green task ─────────────────────────────────────────────
 
 typedef int (*rask_poll_fn)(void *state, void *task_ctx);
@@ -67,6 +86,29 @@ typedef struct GreenTask {
 
     // Per-task ensure hook stack (LIFO cleanup on cancel/panic)
     void           *ensure_stack;
+
+    // Stackful fiber support (fiber_stack == NULL for stackless tasks).
+    // fiber_op is the scheduler action the fiber requested before its last
+    // suspend; the worker performs it after the switch, so a completion can
+    // never resume a fiber that is still running.
+    char           *fiber_stack;      // mmap base (includes guard page)
+    size_t          fiber_map_size;
+    void           *fiber_sp;         // saved stack pointer while suspended
+    void          (*fiber_fn)(void *);
+    void           *fiber_arg;
+    int             fiber_done;
+    char           *fiber_panic;      // parked panic ctx (RASK_PANIC_CTX_MAX)
+    struct {
+        int                 kind;     // FIBER_OP_*
+        int                 fd;
+        void               *buf;
+        size_t              len;
+        const struct iovec *iov;
+        int                 iovcnt;
+        uint64_t            ns;
+        int64_t           (*call)(void *);
+        void               *call_arg;
+    } fiber_op;
 } GreenTask;
 
 // ─── Task handle (returned to user code) ────────────────────
@@ -75,6 +117,36 @@ typedef struct GreenHandle {
     GreenTask *task;
 } GreenHandle;
 
+// ─── Per-worker counters ────────────────────────────────────
+//
+// Single writer (the owning worker) for everything except the overflow
+// counters, so relaxed atomics cost nothing on the hot path. Padded to
+// a cache-line multiple to keep workers from false-sharing each other's
+// counts.
+
+typedef struct {
+    _Atomic int64_t tasks_executed;
+    _Atomic int64_t steals_attempted;
+    _Atomic int64_t steals_succeeded;
+    _Atomic int64_t parks;
+    _Atomic int64_t io_completions;
+    _Atomic int64_t io_poll_ns;     // time inside io->poll (stats dump enabled)
+    _Atomic int64_t io_polls;
+    _Atomic int64_t timers_fired;
+    _Atomic int64_t max_deque_depth;
+    // 9 counters = 72 bytes; pad out to two cache lines.
+    char            pad[128 - 9 * sizeof(int64_t)];
+} WorkerStats;
+
+_Static_assert(sizeof(WorkerStats) % 64 == 0, "WorkerStats cache-line multiple");
+
+// Overflows are rare error paths; any thread may hit them.
+static _Atomic int64_t g_deque_overflows;
+static _Atomic int64_t g_global_overflows;
+
+#define STAT_ADD(field, n) \
+    atomic_fetch_add_explicit(&(field), (n), memory_order_relaxed)
+
 // ─── Chase-Lev work-stealing deque ──────────────────────────
 //
 // Owner: push_bottom / pop_bottom (LIFO, no CAS needed for single owner)
@@ -93,17 +165,17 @@ static void deque_init(WorkDeque *d) {
     atomic_init(&d->bottom, 0);
 }
 
-static void deque_push(WorkDeque *d, GreenTask *task) {
+// Returns -1 when full — the caller spills to the global queue.
+static int deque_push(WorkDeque *d, GreenTask *task) {
     long b = atomic_load_explicit(&d->bottom, memory_order_relaxed);
     long t = atomic_load_explicit(&d->top, memory_order_acquire);
     if (b - t >= DEQUE_CAP) {
-        // Deque full — shouldn't happen with reasonable task counts.
-        // Drop on floor rather than crash; task leaks but runtime stays alive.
-        fprintf(stderr, "rask: work deque overflow\n");
-        return;
+        STAT_ADD(g_deque_overflows, 1);
+        return -1;
     }
     d->buf[b % DEQUE_CAP] = task;
     atomic_store_explicit(&d->bottom, b + 1, memory_order_release);
+    return 0;
 }
 
 static GreenTask *deque_pop(WorkDeque *d) {
@@ -174,6 +246,7 @@ static void gq_push(GlobalQueue *gq, GreenTask *task) {
     if (next == gq->head) {
         // Global queue full
         pthread_mutex_unlock(&gq->lock);
+        STAT_ADD(g_global_overflows, 1);
         fprintf(stderr, "rask: global queue overflow\n");
         return;
     }
@@ -194,20 +267,59 @@ static GreenTask *gq_pop(GlobalQueue *gq) {
     return task;
 }
 
+// ─── Hierarchical timer wheel (types) ───────────────────────
+//
+// One wheel per worker: 4 levels × 64 slots at 1ms tick (64ms / ~4s /
+// ~4.4min / ~4.7h spans; farther deadlines clamp into the top level and
+// re-cascade on expiry). Timed waits cost O(1) insert + O(1) per tick
+// instead of one kernel timeout op per sleeping task.
+//
+// No lock: rask_yield_timeout only runs on the worker executing the
+// task, and each worker advances only its own wheel.
+
+#define WHEEL_LEVELS  4
+#define WHEEL_BITS    6
+#define WHEEL_SLOTS   (1 << WHEEL_BITS)
+#define WHEEL_TICK_NS 1000000ULL // 1ms
+
+typedef struct TimerEntry {
+    GreenTask         *task;
+    uint64_t           deadline_ns;
+    struct TimerEntry *next;
+} TimerEntry;
+
+typedef struct {
+    TimerEntry *slots[WHEEL_LEVELS][WHEEL_SLOTS];
+    TimerEntry *immediate;   // zero-delay yields, drained every loop pass
+    uint64_t    last_tick;   // absolute tick of the last advance
+    int         count;       // armed timers (including immediate)
+} TimerWheel;
+
 // ─── Scheduler ──────────────────────────────────────────────
 
 typedef struct {
     pthread_t       *workers;
     int              worker_count;
     WorkDeque       *local;        // local[worker_id]
+    TimerWheel      *wheels;       // wheels[worker_id]
+    WorkerStats     *wstats;       // wstats[worker_id]
     GlobalQueue      global;
     RaskIoEngine    *io;
+
+    // RASK_SCHED_STATS=<seconds> — periodic stderr dump (0 = off)
+    uint64_t         stats_interval_ns;
+    _Atomic uint64_t stats_last_dump_ns;
     atomic_int       active_tasks;
     atomic_int       shutdown;
 
-    // Parking: workers sleep here when no work found
+    // Parking: workers sleep here when no work found. parked counts
+    // waiters so enqueue can skip the lock when nobody is sleeping.
     pthread_mutex_t  park_lock;
     pthread_cond_t   park_cond;
+    atomic_int       parked;
+
+    // Workers with id >= target_workers go dormant (rask_runtime_resize)
+    atomic_int       target_workers;
 
     // Shutdown barrier: main thread waits here
     pthread_mutex_t  done_lock;
@@ -234,6 +346,17 @@ static uint32_t xorshift32(void) {
     return x;
 }
 
+// Hint to the core that we're in a spin loop (cheaper than sched_yield).
+static inline void cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#else
+    sched_yield();
+#endif
+}
+
 // ─── Task lifecycle ─────────────────────────────────────────
 
 static GreenTask *task_new(rask_poll_fn fn, void *state, int64_t state_size) {
@@ -264,6 +387,8 @@ static void task_release(GreenTask *t) {
         pthread_cond_destroy(&t->done_cond);
         if (t->panic_msg) free(t->panic_msg);
         if (t->state) free(t->state);
+        if (t->fiber_stack) munmap(t->fiber_stack, t->fiber_map_size);
+        if (t->fiber_panic) free(t->fiber_panic);
         free(t);
     }
 }
@@ -282,15 +407,32 @@ static void sched_enqueue(GreenScheduler *s, GreenTask *t) {
     atomic_store_explicit(&t->task_state, TASK_STATE_READY, memory_order_release);
 
     if (tl_worker_id >= 0 && tl_worker_id < s->worker_count) {
-        deque_push(&s->local[tl_worker_id], t);
+        WorkDeque *d = &s->local[tl_worker_id];
+        if (deque_push(d, t) < 0) {
+            // Local deque full (burst of ready tasks) — spill to global
+            gq_push(&s->global, t);
+        } else {
+            long depth =
+                atomic_load_explicit(&d->bottom, memory_order_relaxed) -
+                atomic_load_explicit(&d->top, memory_order_relaxed);
+            WorkerStats *ws = &s->wstats[tl_worker_id];
+            if (depth > atomic_load_explicit(&ws->max_deque_depth,
+                                              memory_order_relaxed))
+                atomic_store_explicit(&ws->max_deque_depth, depth,
+                                      memory_order_relaxed);
+        }
     } else {
         gq_push(&s->global, t);
     }
 
-    // Wake a parked worker
-    pthread_mutex_lock(&s->park_lock);
-    pthread_cond_signal(&s->park_cond);
-    pthread_mutex_unlock(&s->park_lock);
+    // Wake one parked worker — skip the lock entirely when nobody sleeps.
+    // A worker racing into timedwait can miss this, but the 1ms wait bound
+    // caps the stall.
+    if (atomic_load_explicit(&s->parked, memory_order_relaxed) > 0) {
+        pthread_mutex_lock(&s->park_lock);
+        pthread_cond_signal(&s->park_cond);
+        pthread_mutex_unlock(&s->park_lock);
+    }
 }
 
 // I/O completion callback: re-enqueue the task.
@@ -303,11 +445,600 @@ static void io_completion_cb(void *userdata, int64_t result, int err) {
     }
 }
 
+// ─── Accept streams (multishot) ─────────────────────────────
+//
+// One engine submission per listener instead of one per accepted
+// connection. The multishot accept streams client fds into a
+// per-listener ring; rask_yield_accept pops a buffered fd without
+// touching the engine, or parks as a waiter when the ring is empty.
+// A -1 firing ends the stream: waiters wake with the error and the
+// stream is dropped once the ring drains, so the next accept on a
+// (possibly reused) fd re-arms from scratch.
+
+#define ACCEPT_RING 64
+
+typedef struct AcceptWaiter {
+    GreenTask           *task;
+    struct AcceptWaiter *next;
+} AcceptWaiter;
+
+typedef struct AcceptStream {
+    int  listen_fd;
+    int  closed;            // terminal firing seen; ring may still drain
+    int  term_err;
+    int  ring[ACCEPT_RING]; // accepted fds with no waiter yet
+    int  head, count;
+    AcceptWaiter *waiters, *waiters_tail; // FIFO
+    struct AcceptStream *next;
+} AcceptStream;
+
+static pthread_mutex_t g_accept_lock = PTHREAD_MUTEX_INITIALIZER;
+static AcceptStream   *g_accept_streams;
+
+static AcceptStream *accept_stream_find(int listen_fd) {
+    for (AcceptStream *st = g_accept_streams; st; st = st->next) {
+        if (st->listen_fd == listen_fd) return st;
+    }
+    return NULL;
+}
+
+static void accept_stream_drop(AcceptStream *st) {
+    AcceptStream **pp = &g_accept_streams;
+    while (*pp && *pp != st) pp = &(*pp)->next;
+    if (*pp) *pp = st->next;
+    free(st);
+}
+
+// Engine callback — once per accepted connection, then once with result
+// -1 when the stream ends. Tasks are enqueued outside the lock: both
+// engines can fire this synchronously from inside submit.
+static void accept_stream_cb(void *ud, int64_t result, int err) {
+    AcceptStream *st = (AcceptStream *)ud;
+    GreenTask    *wake   = NULL;
+    AcceptWaiter *failed = NULL;
+
+    pthread_mutex_lock(&g_accept_lock);
+    if (result < 0) {
+        // Stream over (forget_fd cancel or accept failure). The engine
+        // slot is already gone; the stream follows once the ring drains.
+        st->closed   = 1;
+        st->term_err = err;
+        failed = st->waiters;
+        st->waiters = st->waiters_tail = NULL;
+        if (st->count == 0) accept_stream_drop(st);
+    } else if (st->waiters) {
+        AcceptWaiter *w = st->waiters;
+        st->waiters = w->next;
+        if (!st->waiters) st->waiters_tail = NULL;
+        wake = w->task;
+        free(w);
+    } else if (st->count < ACCEPT_RING) {
+        st->ring[(st->head + st->count) % ACCEPT_RING] = (int)result;
+        st->count++;
+    } else {
+        // Nobody accepting and the ring is full — shed the connection
+        // rather than hoard fds for a listener the program ignores.
+        close((int)result);
+    }
+    pthread_mutex_unlock(&g_accept_lock);
+
+    if (wake) {
+        wake->io_result = result;
+        wake->io_err    = 0;
+        if (g_sched) sched_enqueue(g_sched, wake);
+    }
+    while (failed) {
+        AcceptWaiter *w = failed;
+        failed = w->next;
+        w->task->io_result = -1;
+        w->task->io_err    = err;
+        if (g_sched) sched_enqueue(g_sched, w->task);
+        free(w);
+    }
+}
+
+// Hand a quiescent task to the accept stream for listen_fd: complete it
+// from the ring (or the terminal error) and re-enqueue, otherwise park
+// it as a waiter, arming the multishot on first use of the listener.
+static void accept_begin(GreenScheduler *s, GreenTask *t, int listen_fd) {
+    if (!s->io->submit_accept_multi) {
+        s->io->submit_accept(s->io, listen_fd, io_completion_cb, t);
+        return;
+    }
+
+    int arm = 0;
+    pthread_mutex_lock(&g_accept_lock);
+    AcceptStream *st = accept_stream_find(listen_fd);
+    if (st && st->count > 0) {
+        int fd = st->ring[st->head];
+        st->head = (st->head + 1) % ACCEPT_RING;
+        st->count--;
+        if (st->closed && st->count == 0) accept_stream_drop(st);
+        pthread_mutex_unlock(&g_accept_lock);
+        t->io_result = fd;
+        t->io_err    = 0;
+        sched_enqueue(s, t);
+        return;
+    }
+    if (st && st->closed) {
+        int term = st->term_err;
+        accept_stream_drop(st);
+        pthread_mutex_unlock(&g_accept_lock);
+        t->io_result = -1;
+        t->io_err    = term;
+        sched_enqueue(s, t);
+        return;
+    }
+    if (!st) {
+        st = (AcceptStream *)calloc(1, sizeof(AcceptStream));
+        if (!st) {
+            pthread_mutex_unlock(&g_accept_lock);
+            t->io_result = -1;
+            t->io_err    = ENOMEM;
+            sched_enqueue(s, t);
+            return;
+        }
+        st->listen_fd = listen_fd;
+        st->next = g_accept_streams;
+        g_accept_streams = st;
+        arm = 1;
+    }
+    AcceptWaiter *w = (AcceptWaiter *)malloc(sizeof(AcceptWaiter));
+    if (!w) {
+        if (arm) accept_stream_drop(st);
+        pthread_mutex_unlock(&g_accept_lock);
+        t->io_result = -1;
+        t->io_err    = ENOMEM;
+        sched_enqueue(s, t);
+        return;
+    }
+    w->task = t;
+    w->next = NULL;
+    if (st->waiters_tail) st->waiters_tail->next = w;
+    else                  st->waiters = w;
+    st->waiters_tail = w;
+    pthread_mutex_unlock(&g_accept_lock);
+
+    // Arm outside the lock — a synchronous firing (epoll drains the
+    // backlog during submit) re-enters accept_stream_cb, which takes it.
+    if (arm) {
+        s->io->submit_accept_multi(s->io, listen_fd, accept_stream_cb, st);
+    }
+}
+
+// ─── Hierarchical timer wheel (ops) ─────────────────────────
+
+// Wheel ticks come from the fast clock — workers read it on every poll,
+// and the tick granularity dwarfs calibration error.
+static uint64_t wheel_clock_ns(void) {
+    return (uint64_t)rask_time_Instant_now_fast();
+}
+
+static void wheel_insert(TimerWheel *w, GreenTask *t, uint64_t deadline_ns) {
+    TimerEntry *e = (TimerEntry *)malloc(sizeof(TimerEntry));
+    if (!e) {
+        // Can't arm the timer — re-enqueue immediately rather than strand
+        t->io_result = 0;
+        t->io_err    = 0;
+        sched_enqueue(g_sched, t);
+        return;
+    }
+    e->task        = t;
+    e->deadline_ns = deadline_ns;
+
+    uint64_t dl_tick = deadline_ns / WHEEL_TICK_NS;
+    uint64_t delta   = dl_tick > w->last_tick ? dl_tick - w->last_tick : 0;
+
+    if (delta == 0) {
+        e->next = w->immediate;
+        w->immediate = e;
+        w->count++;
+        return;
+    }
+
+    int level = 0;
+    uint64_t span = WHEEL_SLOTS;
+    while (level < WHEEL_LEVELS - 1 && delta >= span) {
+        span <<= WHEEL_BITS;
+        level++;
+    }
+    if (delta >= span) delta = span - 1; // clamp; re-cascades on expiry
+
+    uint64_t slot = ((w->last_tick + delta) >> (WHEEL_BITS * level))
+                    & (WHEEL_SLOTS - 1);
+    e->next = w->slots[level][slot];
+    w->slots[level][slot] = e;
+    w->count++;
+}
+
+// Fire every entry in a detached list.
+static void wheel_fire_list(GreenScheduler *s, TimerWheel *w, TimerEntry *e) {
+    while (e) {
+        TimerEntry *next = e->next;
+        e->task->io_result = 0;
+        e->task->io_err    = 0;
+        sched_enqueue(s, e->task);
+        free(e);
+        w->count--;
+        if (tl_worker_id >= 0)
+            STAT_ADD(s->wstats[tl_worker_id].timers_fired, 1);
+        e = next;
+    }
+}
+
+static void wheel_advance(GreenScheduler *s, TimerWheel *w) {
+    uint64_t now_tick = wheel_clock_ns() / WHEEL_TICK_NS;
+
+    if (w->immediate) {
+        TimerEntry *list = w->immediate;
+        w->immediate = NULL;
+        wheel_fire_list(s, w, list);
+    }
+
+    if (w->count == 0) {
+        w->last_tick = now_tick; // nothing armed — skip empty slot walking
+        return;
+    }
+
+    while (w->last_tick < now_tick) {
+        w->last_tick++;
+        uint64_t tick = w->last_tick;
+
+        // Level-0 wrap: pull one slot down from each wrapped higher level
+        if ((tick & (WHEEL_SLOTS - 1)) == 0) {
+            for (int l = 1; l < WHEEL_LEVELS; l++) {
+                uint64_t slot = (tick >> (WHEEL_BITS * l)) & (WHEEL_SLOTS - 1);
+                TimerEntry *list = w->slots[l][slot];
+                w->slots[l][slot] = NULL;
+                while (list) {
+                    TimerEntry *next = list->next;
+                    w->count--;
+                    wheel_insert(w, list->task, list->deadline_ns);
+                    free(list);
+                    list = next;
+                }
+                if (slot != 0) break; // this level didn't wrap — stop
+            }
+        }
+
+        TimerEntry *due = w->slots[0][tick & (WHEEL_SLOTS - 1)];
+        w->slots[0][tick & (WHEEL_SLOTS - 1)] = NULL;
+        wheel_fire_list(s, w, due);
+    }
+
+    // Cascading may have landed already-due entries on the immediate list
+    if (w->immediate) {
+        TimerEntry *list = w->immediate;
+        w->immediate = NULL;
+        wheel_fire_list(s, w, list);
+    }
+}
+
+// Release leftover entries at shutdown (normally empty — shutdown waits
+// for active tasks, and every armed timer belongs to an active task).
+static void wheel_drain(TimerWheel *w) {
+    for (int l = 0; l < WHEEL_LEVELS; l++) {
+        for (int sl = 0; sl < WHEEL_SLOTS; sl++) {
+            TimerEntry *e = w->slots[l][sl];
+            while (e) { TimerEntry *n = e->next; free(e); e = n; }
+        }
+    }
+    TimerEntry *e = w->immediate;
+    while (e) { TimerEntry *n = e->next; free(e); e = n; }
+}
+
 // ─── Panic handling for green tasks ─────────────────────────
 
 extern jmp_buf *rask_panic_jmpbuf(void);
 extern void     rask_panic_activate(void);
 extern char    *rask_panic_take_message(void);
+extern void     rask_panic_ctx_export(void *out);
+extern void     rask_panic_ctx_import(const void *in);
+extern void     rask_ensure_run_all(void);
+
+// ─── Stackful fibers (Phase B) ──────────────────────────────
+//
+// A fiber is a task that runs ordinary call-stack code instead of a poll
+// state machine. Its poll_fn resumes the fiber with a context switch; the
+// fiber suspends itself from inside rask_yield* or rask_fiber_blocking.
+// Suspension records the requested scheduler action in task->fiber_op and
+// the WORKER performs it after the switch — that way an I/O completion or
+// pool thread can never re-enqueue (and another worker resume) a fiber
+// whose stack is still live.
+//
+// The fiber's panic jmp_buf targets its own stack, so the panic context is
+// parked in the task across suspensions and stays valid on whichever
+// worker resumes it.
+
+static __thread void      *tl_worker_sp   = NULL; // where to switch back to
+static __thread GreenTask *tl_fiber_task  = NULL; // non-NULL while a fiber runs
+
+// Save callee-saved registers + stack pointer, switch stacks, restore.
+void rask_fiber_switch(void **save_sp, void *restore_sp);
+
+#if defined(__x86_64__)
+__asm__(
+    ".text\n"
+    ".align 16\n"
+    ".globl rask_fiber_switch\n"
+    ".type rask_fiber_switch, @function\n"
+    "rask_fiber_switch:\n"
+    "    pushq %rbp\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    movq %rsp, (%rdi)\n"
+    "    movq %rsi, %rsp\n"
+    "    popq %r15\n"
+    "    popq %r14\n"
+    "    popq %r13\n"
+    "    popq %r12\n"
+    "    popq %rbx\n"
+    "    popq %rbp\n"
+    "    ret\n"
+    ".size rask_fiber_switch, . - rask_fiber_switch\n");
+
+// First resume: the switch's ret lands here with the task in r12.
+__asm__(
+    ".text\n"
+    ".align 16\n"
+    ".globl rask_fiber_start\n"
+    ".type rask_fiber_start, @function\n"
+    "rask_fiber_start:\n"
+    "    movq %r12, %rdi\n"
+    "    call rask_fiber_entry\n"
+    "    ud2\n"
+    ".size rask_fiber_start, . - rask_fiber_start\n");
+
+#elif defined(__aarch64__)
+__asm__(
+    ".text\n"
+    ".align 4\n"
+    ".globl rask_fiber_switch\n"
+    ".type rask_fiber_switch, %function\n"
+    "rask_fiber_switch:\n"
+    "    sub sp, sp, #160\n"
+    "    stp x19, x20, [sp, #0]\n"
+    "    stp x21, x22, [sp, #16]\n"
+    "    stp x23, x24, [sp, #32]\n"
+    "    stp x25, x26, [sp, #48]\n"
+    "    stp x27, x28, [sp, #64]\n"
+    "    stp x29, x30, [sp, #80]\n"
+    "    stp d8,  d9,  [sp, #96]\n"
+    "    stp d10, d11, [sp, #112]\n"
+    "    stp d12, d13, [sp, #128]\n"
+    "    stp d14, d15, [sp, #144]\n"
+    "    mov x2, sp\n"
+    "    str x2, [x0]\n"
+    "    mov sp, x1\n"
+    "    ldp x19, x20, [sp, #0]\n"
+    "    ldp x21, x22, [sp, #16]\n"
+    "    ldp x23, x24, [sp, #32]\n"
+    "    ldp x25, x26, [sp, #48]\n"
+    "    ldp x27, x28, [sp, #64]\n"
+    "    ldp x29, x30, [sp, #80]\n"
+    "    ldp d8,  d9,  [sp, #96]\n"
+    "    ldp d10, d11, [sp, #112]\n"
+    "    ldp d12, d13, [sp, #128]\n"
+    "    ldp d14, d15, [sp, #144]\n"
+    "    add sp, sp, #160\n"
+    "    ret\n"
+    ".size rask_fiber_switch, . - rask_fiber_switch\n");
+
+// First resume: x30 points here with the task in x19.
+__asm__(
+    ".text\n"
+    ".align 4\n"
+    ".globl rask_fiber_start\n"
+    ".type rask_fiber_start, %function\n"
+    "rask_fiber_start:\n"
+    "    mov x0, x19\n"
+    "    bl rask_fiber_entry\n"
+    "    brk #0\n"
+    ".size rask_fiber_start, . - rask_fiber_start\n");
+#else
+#error "rask_fiber_switch not implemented for this architecture"
+#endif
+
+void rask_fiber_start(void);
+
+// Fiber body wrapper — runs on the fiber stack. The setjmp frame here lives
+// for the whole fiber, so panics anywhere in the fiber land on the fiber's
+// own stack (never a cross-stack longjmp into a worker frame).
+void rask_fiber_entry(GreenTask *t);
+void rask_fiber_entry(GreenTask *t) {
+    rask_panic_install();
+    jmp_buf *jb = rask_panic_jmpbuf();
+    if (setjmp(*jb) == 0) {
+        rask_panic_activate();
+        t->fiber_fn(t->fiber_arg);
+    } else {
+        rask_ensure_run_all();
+        t->panic_msg = rask_panic_take_message();
+        t->result = -1;
+    }
+    rask_panic_remove();
+    t->fiber_done = 1;
+    rask_fiber_switch(&t->fiber_sp, tl_worker_sp);
+    __builtin_unreachable();
+}
+
+// Suspend the running fiber back to its worker. noinline: no TLS address
+// may be cached across the switch — the fiber can resume on another thread.
+__attribute__((noinline))
+static void fiber_suspend(GreenTask *t) {
+    rask_fiber_switch(&t->fiber_sp, tl_worker_sp);
+}
+
+static void fiber_stack_setup(GreenTask *t) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t map_size = FIBER_STACK_SIZE + page;
+    char *mem = (char *)mmap(NULL, map_size, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+    if (mem == MAP_FAILED) {
+        rask_panic("fiber stack allocation failed");
+    }
+    mprotect(mem, page, PROT_NONE); // guard page below the stack
+
+    t->fiber_stack   = mem;
+    t->fiber_map_size = map_size;
+    t->fiber_panic   = (char *)calloc(1, RASK_PANIC_CTX_MAX);
+    if (!t->fiber_panic) {
+        rask_panic("fiber alloc failed");
+    }
+
+    uint64_t top = ((uint64_t)(mem + map_size)) & ~15ULL;
+    uint64_t *sp = (uint64_t *)top;
+#if defined(__x86_64__)
+    *--sp = (uint64_t)rask_fiber_start; // ret target of the first switch
+    *--sp = 0;                          // rbp
+    *--sp = 0;                          // rbx
+    *--sp = (uint64_t)t;                // r12 — task for the trampoline
+    *--sp = 0;                          // r13
+    *--sp = 0;                          // r14
+    *--sp = 0;                          // r15
+#elif defined(__aarch64__)
+    sp -= 20; // 160-byte register frame
+    memset(sp, 0, 160);
+    sp[0]  = (uint64_t)t;                // x19 — task for the trampoline
+    sp[11] = (uint64_t)rask_fiber_start; // x30
+#endif
+    t->fiber_sp = sp;
+}
+
+// ─── Blocking-call pool ─────────────────────────────────────
+//
+// Runs rask_fiber_blocking bodies on plain OS threads so a blocking C call
+// (DB client, DNS, fsync) parks only its fiber, never a worker. Threads are
+// spawned on demand up to BLOCKING_POOL_MAX and kept around; the pool is
+// process-global so it survives runtime init/shutdown cycles.
+
+typedef struct BlockingItem {
+    GreenTask           *task;
+    struct BlockingItem *next;
+} BlockingItem;
+
+static pthread_mutex_t bp_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  bp_cond = PTHREAD_COND_INITIALIZER;
+static BlockingItem   *bp_head = NULL;
+static BlockingItem   *bp_tail = NULL;
+static int             bp_threads = 0;
+static int             bp_idle = 0;
+
+static void *blocking_pool_entry(void *arg) {
+    (void)arg;
+    for (;;) {
+        pthread_mutex_lock(&bp_lock);
+        while (!bp_head) {
+            bp_idle++;
+            pthread_cond_wait(&bp_cond, &bp_lock);
+            bp_idle--;
+        }
+        BlockingItem *it = bp_head;
+        bp_head = it->next;
+        if (!bp_head) bp_tail = NULL;
+        pthread_mutex_unlock(&bp_lock);
+
+        GreenTask *t = it->task;
+        free(it);
+        t->io_result = t->fiber_op.call(t->fiber_op.call_arg);
+        t->io_err    = 0;
+        if (g_sched) {
+            sched_enqueue(g_sched, t); // pool thread → global queue
+        }
+    }
+    return NULL;
+}
+
+static void blocking_pool_submit(GreenTask *t) {
+    BlockingItem *it = (BlockingItem *)malloc(sizeof(BlockingItem));
+    if (!it) {
+        fprintf(stderr, "rask: blocking pool alloc failed\n");
+        abort();
+    }
+    it->task = t;
+    it->next = NULL;
+
+    pthread_mutex_lock(&bp_lock);
+    if (bp_tail) bp_tail->next = it;
+    else         bp_head = it;
+    bp_tail = it;
+    if (bp_idle == 0 && bp_threads < BLOCKING_POOL_MAX) {
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+        pthread_t th;
+        if (pthread_create(&th, &attr, blocking_pool_entry, NULL) == 0) {
+            bp_threads++;
+        }
+        pthread_attr_destroy(&attr);
+    }
+    pthread_cond_signal(&bp_cond);
+    pthread_mutex_unlock(&bp_lock);
+}
+
+// ─── Fiber poll adapter ─────────────────────────────────────
+//
+// Makes a fiber look like any other task to execute_task: each poll resumes
+// the fiber, and the return value is READY once the fiber body finished.
+
+static int fiber_poll_fn(void *state, void *task_ctx) {
+    (void)state;
+    GreenTask *t = (GreenTask *)task_ctx;
+    GreenScheduler *s = g_sched;
+
+    // Swap in the fiber's parked panic context (jmp_buf on the fiber stack),
+    // keeping the worker's own handler safe for after the switch.
+    char worker_panic[RASK_PANIC_CTX_MAX];
+    rask_panic_ctx_export(worker_panic);
+    rask_panic_ctx_import(t->fiber_panic);
+
+    tl_fiber_task = t;
+    rask_fiber_switch(&tl_worker_sp, t->fiber_sp);
+    tl_fiber_task = NULL;
+
+    rask_panic_ctx_export(t->fiber_panic);
+    rask_panic_ctx_import(worker_panic);
+
+    // Perform the action the fiber requested before suspending. Doing it
+    // here (not in the fiber) means the task can only be re-enqueued once
+    // its stack is quiescent.
+    int op = t->fiber_op.kind;
+    t->fiber_op.kind = FIBER_OP_NONE;
+    switch (op) {
+    case FIBER_OP_YIELD:
+        wheel_insert(&s->wheels[tl_worker_id], t, 0);
+        break;
+    case FIBER_OP_TIMEOUT:
+        wheel_insert(&s->wheels[tl_worker_id], t,
+                     wheel_clock_ns() + t->fiber_op.ns);
+        break;
+    case FIBER_OP_READ:
+        s->io->submit_read(s->io, t->fiber_op.fd, t->fiber_op.buf,
+                           t->fiber_op.len, io_completion_cb, t);
+        break;
+    case FIBER_OP_WRITE:
+        s->io->submit_write(s->io, t->fiber_op.fd, t->fiber_op.buf,
+                            t->fiber_op.len, io_completion_cb, t);
+        break;
+    case FIBER_OP_WRITEV:
+        s->io->submit_writev(s->io, t->fiber_op.fd, t->fiber_op.iov,
+                             t->fiber_op.iovcnt, io_completion_cb, t);
+        break;
+    case FIBER_OP_ACCEPT:
+        accept_begin(s, t, t->fiber_op.fd);
+        break;
+    case FIBER_OP_BLOCKING:
+        blocking_pool_submit(t);
+        break;
+    default:
+        break;
+    }
+
+    return t->fiber_done ? RASK_POLL_READY : RASK_POLL_PENDING;
+}
 
 // ─── Ensure hooks (LIFO cleanup stack) ──────────────────────
 //
@@ -323,6 +1054,8 @@ extern void   rask_ensure_run_all(void);
 // ─── Execute a single task ──────────────────────────────────
 
 static void execute_task(GreenScheduler *s, GreenTask *t) {
+    if (tl_worker_id >= 0)
+        STAT_ADD(s->wstats[tl_worker_id].tasks_executed, 1);
     atomic_store_explicit(&t->task_state, TASK_STATE_RUNNING,
                           memory_order_release);
     tl_current_task = t;
@@ -378,16 +1111,91 @@ static void execute_task(GreenScheduler *s, GreenTask *t) {
     }
 }
 
+// ─── Scheduler stats ────────────────────────────────────────
+
+void rask_sched_stats(RaskSchedStats *out) {
+    memset(out, 0, sizeof(*out));
+    GreenScheduler *s = g_sched;
+    if (!s) return;
+
+    out->workers      = s->worker_count;
+    out->active_tasks = atomic_load_explicit(&s->active_tasks,
+                                              memory_order_relaxed);
+    for (int i = 0; i < s->worker_count; i++) {
+        WorkerStats *ws = &s->wstats[i];
+        out->tasks_executed   += atomic_load_explicit(&ws->tasks_executed,   memory_order_relaxed);
+        out->steals_attempted += atomic_load_explicit(&ws->steals_attempted, memory_order_relaxed);
+        out->steals_succeeded += atomic_load_explicit(&ws->steals_succeeded, memory_order_relaxed);
+        out->parks            += atomic_load_explicit(&ws->parks,            memory_order_relaxed);
+        out->io_completions   += atomic_load_explicit(&ws->io_completions,   memory_order_relaxed);
+        out->io_poll_ns       += atomic_load_explicit(&ws->io_poll_ns,       memory_order_relaxed);
+        out->io_polls         += atomic_load_explicit(&ws->io_polls,         memory_order_relaxed);
+        out->timers_fired     += atomic_load_explicit(&ws->timers_fired,     memory_order_relaxed);
+
+        int64_t depth = atomic_load_explicit(&ws->max_deque_depth,
+                                              memory_order_relaxed);
+        if (depth > out->max_deque_depth) out->max_deque_depth = depth;
+    }
+    out->deque_overflows  = atomic_load_explicit(&g_deque_overflows,
+                                                  memory_order_relaxed);
+    out->global_overflows = atomic_load_explicit(&g_global_overflows,
+                                                  memory_order_relaxed);
+}
+
+static void sched_stats_dump(void) {
+    RaskSchedStats st;
+    rask_sched_stats(&st);
+
+    int64_t avg_poll_us = st.io_polls > 0
+        ? st.io_poll_ns / st.io_polls / 1000
+        : 0;
+    fprintf(stderr,
+            "rask-sched: workers=%lld active=%lld exec=%lld "
+            "steal=%lld/%lld parks=%lld io=%lld poll-avg=%lldus "
+            "timers=%lld maxdepth=%lld overflow=%lld/%lld\n",
+            (long long)st.workers, (long long)st.active_tasks,
+            (long long)st.tasks_executed,
+            (long long)st.steals_succeeded, (long long)st.steals_attempted,
+            (long long)st.parks, (long long)st.io_completions,
+            (long long)avg_poll_us,
+            (long long)st.timers_fired, (long long)st.max_deque_depth,
+            (long long)st.deque_overflows, (long long)st.global_overflows);
+}
+
 // ─── Worker loop ────────────────────────────────────────────
 
+// Park on the condvar for up to 1ms (re-check I/O and timers after).
+static void worker_park_1ms(GreenScheduler *s, int my_id) {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_nsec += 1000000; // 1ms
+    if (ts.tv_nsec >= 1000000000L) {
+        ts.tv_sec += 1;
+        ts.tv_nsec -= 1000000000L;
+    }
+    STAT_ADD(s->wstats[my_id].parks, 1);
+    pthread_mutex_lock(&s->park_lock);
+    atomic_fetch_add_explicit(&s->parked, 1, memory_order_relaxed);
+    pthread_cond_timedwait(&s->park_cond, &s->park_lock, &ts);
+    atomic_fetch_sub_explicit(&s->parked, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&s->park_lock);
+}
+
+// Boot args handed to each worker thread; the worker frees them. The id
+// must come from init, not a process-wide counter — the scheduler can be
+// torn down and rebuilt (one `using Multitasking` block after another),
+// and ids have to restart at 0 each cycle or workers index past the
+// per-worker arrays.
+typedef struct {
+    GreenScheduler *sched;
+    int             id;
+} WorkerBoot;
+
 static void *worker_entry(void *arg) {
-    GreenScheduler *s = (GreenScheduler *)arg;
-    // Compute worker_id from thread identity — use global queue push order
-    // Actually, we pack the id into the arg pointer for simplicity.
-    // Re-encode: we store worker_id in upper bits. Nah — use a proper struct.
-    // Simpler: use a static counter.
-    static atomic_int next_id = ATOMIC_VAR_INIT(0);
-    int my_id = atomic_fetch_add_explicit(&next_id, 1, memory_order_relaxed);
+    WorkerBoot *boot = (WorkerBoot *)arg;
+    GreenScheduler *s = boot->sched;
+    int my_id = boot->id;
+    free(boot);
     tl_worker_id = my_id;
     tl_rng_state = (uint32_t)(my_id + 1) * 2654435761U;
 
@@ -396,15 +1204,50 @@ static void *worker_entry(void *arg) {
     while (!atomic_load_explicit(&s->shutdown, memory_order_acquire)) {
         GreenTask *task = NULL;
 
+        // Resized out? Go dormant: keep this worker's timer wheel ticking
+        // and hand queued tasks to the others, but take no new work.
+        if (my_id >= atomic_load_explicit(&s->target_workers,
+                                           memory_order_acquire)) {
+            wheel_advance(s, &s->wheels[my_id]);
+            GreenTask *stray;
+            while ((stray = deque_pop(&s->local[my_id])) != NULL) {
+                gq_push(&s->global, stray);
+            }
+            worker_park_1ms(s, my_id);
+            continue;
+        }
+
+        // 0. Expire due timers on this worker's wheel
+        wheel_advance(s, &s->wheels[my_id]);
+
+        // Periodic stats dump (one worker claims each interval via CAS)
+        if (s->stats_interval_ns) {
+            uint64_t now = wheel_clock_ns();
+            uint64_t last = atomic_load_explicit(&s->stats_last_dump_ns,
+                                                  memory_order_relaxed);
+            if (now - last >= s->stats_interval_ns &&
+                atomic_compare_exchange_strong_explicit(
+                    &s->stats_last_dump_ns, &last, now,
+                    memory_order_relaxed, memory_order_relaxed)) {
+                sched_stats_dump();
+            }
+        }
+
         // 1. Pop from local deque
         task = deque_pop(&s->local[my_id]);
 
-        // 2. Steal from a random peer
-        if (!task) {
-            int target = (int)(xorshift32() % (uint32_t)s->worker_count);
-            if (target != my_id) {
+        // 2. Steal: sweep every peer from a random start (dormant workers
+        // included — their deques may still hold strays)
+        if (!task && s->worker_count > 1) {
+            int start = (int)(xorshift32() % (uint32_t)s->worker_count);
+            for (int i = 0; i < s->worker_count && !task; i++) {
+                int target = (start + i) % s->worker_count;
+                if (target == my_id) continue;
+                STAT_ADD(s->wstats[my_id].steals_attempted, 1);
                 task = deque_steal(&s->local[target]);
             }
+            if (task)
+                STAT_ADD(s->wstats[my_id].steals_succeeded, 1);
         }
 
         // 3. Pop from global queue
@@ -418,33 +1261,41 @@ static void *worker_entry(void *arg) {
             continue;
         }
 
-        // 4. Poll I/O (non-blocking)
+        // 4. Poll I/O (non-blocking); poll latency is only timed when the
+        // periodic dump is on, to keep the idle loop free of clock reads
         if (s->io) {
-            int fired = s->io->poll(s->io, 0);
+            int fired;
+            if (s->stats_interval_ns) {
+                uint64_t t0 = wheel_clock_ns();
+                fired = s->io->poll(s->io, 0);
+                STAT_ADD(s->wstats[my_id].io_poll_ns,
+                         (int64_t)(wheel_clock_ns() - t0));
+                STAT_ADD(s->wstats[my_id].io_polls, 1);
+            } else {
+                fired = s->io->poll(s->io, 0);
+            }
             if (fired > 0) {
+                STAT_ADD(s->wstats[my_id].io_completions, fired);
                 idle_spins = 0;
                 continue;
             }
         }
 
-        // 5. No work — spin briefly before parking
+        // 5. No work — adaptive spin before parking. A brief busy-wait
+        // phase keeps cross-worker wakeups at cache-miss latency; the
+        // yield phase backs off before paying the park/unpark round trip.
         idle_spins++;
         if (idle_spins < 64) {
+            cpu_relax();
+            continue;
+        }
+        if (idle_spins < 128) {
             sched_yield();
             continue;
         }
 
-        // 6. Park on condvar (with timeout to recheck I/O)
-        struct timespec ts;
-        clock_gettime(CLOCK_REALTIME, &ts);
-        ts.tv_nsec += 1000000; // 1ms
-        if (ts.tv_nsec >= 1000000000L) {
-            ts.tv_sec += 1;
-            ts.tv_nsec -= 1000000000L;
-        }
-        pthread_mutex_lock(&s->park_lock);
-        pthread_cond_timedwait(&s->park_cond, &s->park_lock, &ts);
-        pthread_mutex_unlock(&s->park_lock);
+        // 6. Park on condvar (with timeout to recheck I/O and timers)
+        worker_park_1ms(s, my_id);
         idle_spins = 0;
     }
 
@@ -456,6 +1307,8 @@ static void *worker_entry(void *arg) {
 void rask_runtime_init(int64_t worker_count) {
     if (g_sched) return; // already initialized
 
+    rask_time_fast_clock_init(); // calibrate before workers need timestamps
+
     GreenScheduler *s = (GreenScheduler *)calloc(1, sizeof(GreenScheduler));
     if (!s) {
         fprintf(stderr, "rask: scheduler alloc failed\n");
@@ -470,23 +1323,35 @@ void rask_runtime_init(int64_t worker_count) {
     s->worker_count = (int)worker_count;
     s->workers = (pthread_t *)calloc((size_t)worker_count, sizeof(pthread_t));
     s->local   = (WorkDeque *)calloc((size_t)worker_count, sizeof(WorkDeque));
-    if (!s->workers || !s->local) {
+    s->wheels  = (TimerWheel *)calloc((size_t)worker_count, sizeof(TimerWheel));
+    s->wstats  = (WorkerStats *)calloc((size_t)worker_count, sizeof(WorkerStats));
+    if (!s->workers || !s->local || !s->wheels || !s->wstats) {
         fprintf(stderr, "rask: scheduler arrays alloc failed\n");
         abort();
     }
 
+    uint64_t now_tick = wheel_clock_ns() / WHEEL_TICK_NS;
     for (int i = 0; i < s->worker_count; i++) {
         deque_init(&s->local[i]);
+        s->wheels[i].last_tick = now_tick;
     }
 
     gq_init(&s->global);
     atomic_init(&s->active_tasks, 0);
     atomic_init(&s->shutdown, 0);
+    atomic_init(&s->parked, 0);
+    atomic_init(&s->target_workers, (int)worker_count);
     pthread_mutex_init(&s->park_lock, NULL);
     pthread_cond_init(&s->park_cond, NULL);
     pthread_mutex_init(&s->done_lock, NULL);
     pthread_cond_init(&s->done_cond, NULL);
 
+    const char *stats_env = getenv("RASK_SCHED_STATS");
+    if (stats_env && atoi(stats_env) > 0) {
+        s->stats_interval_ns = (uint64_t)atoi(stats_env) * 1000000000ULL;
+        atomic_init(&s->stats_last_dump_ns, wheel_clock_ns());
+    }
+
     // Create I/O engine
     s->io = rask_io_create();
     // NULL is acceptable — scheduler works without I/O, tasks just can't yield on I/O
@@ -495,7 +1360,14 @@ void rask_runtime_init(int64_t worker_count) {
 
     // Spawn worker threads
     for (int i = 0; i < s->worker_count; i++) {
-        int err = pthread_create(&s->workers[i], NULL, worker_entry, s);
+        WorkerBoot *boot = (WorkerBoot *)malloc(sizeof(WorkerBoot));
+        if (!boot) {
+            fprintf(stderr, "rask: worker boot alloc failed\n");
+            abort();
+        }
+        boot->sched = s;
+        boot->id    = i;
+        int err = pthread_create(&s->workers[i], NULL, worker_entry, boot);
         if (err != 0) {
             fprintf(stderr, "rask: failed to create worker thread %d: %d\n",
                     i, err);
@@ -504,6 +1376,23 @@ void rask_runtime_init(int64_t worker_count) {
     }
 }
 
+// Shrink or restore the active worker set. Threads are created once at
+// init, so n clamps to [1, init worker count]; workers above the target
+// go dormant (timer wheels keep ticking, queued work is handed off).
+void rask_runtime_resize(int64_t n) {
+    GreenScheduler *s = g_sched;
+    if (!s) return;
+
+    if (n < 1) n = 1;
+    if (n > s->worker_count) n = s->worker_count;
+    atomic_store_explicit(&s->target_workers, (int)n, memory_order_release);
+
+    // Wake everyone so dormant workers notice a raised target promptly
+    pthread_mutex_lock(&s->park_lock);
+    pthread_cond_broadcast(&s->park_cond);
+    pthread_mutex_unlock(&s->park_lock);
+}
+
 void rask_runtime_shutdown(void) {
     GreenScheduler *s = g_sched;
     if (!s) return;
@@ -536,11 +1425,29 @@ void rask_runtime_shutdown(void) {
 
     // Cleanup
     if (s->io) s->io->destroy(s->io);
+    // Drop leftover accept streams; no waiters remain (active_tasks is
+    // zero) but buffered fds would leak across init/shutdown cycles.
+    pthread_mutex_lock(&g_accept_lock);
+    while (g_accept_streams) {
+        AcceptStream *st = g_accept_streams;
+        g_accept_streams = st->next;
+        for (int i = 0; i < st->count; i++) {
+            close(st->ring[(st->head + i) % ACCEPT_RING]);
+        }
+        free(st);
+    }
+    pthread_mutex_unlock(&g_accept_lock);
+    for (int i = 0; i < s->worker_count; i++) {
+        wheel_drain(&s->wheels[i]);
+    }
     gq_destroy(&s->global);
     pthread_mutex_destroy(&s->park_lock);
     pthread_cond_destroy(&s->park_cond);
     pthread_mutex_destroy(&s->done_lock);
     pthread_cond_destroy(&s->done_cond);
+    if (s->stats_interval_ns) sched_stats_dump(); // final dump at shutdown
+    free(s->wstats);
+    free(s->wheels);
     free(s->local);
     free(s->workers);
     free(s);
@@ -568,6 +1475,46 @@ void *rask_green_spawn(void *poll_fn, void *state, int64_t state_size) {
     return h;
 }
 
+// Spawn a stackful fiber: fn(arg) runs on its own mmap'd stack and may call
+// rask_yield*, rask_fiber_blocking, or plain C anywhere in its call graph.
+// Joinable/cancellable like any other task.
+void *rask_green_spawn_fiber(void (*fn)(void *), void *arg) {
+    GreenScheduler *s = g_sched;
+    if (!s) {
+        rask_panic("spawn outside `using Multitasking {}` block");
+    }
+
+    GreenTask *t = task_new(fiber_poll_fn, NULL, 0);
+    t->fiber_fn  = fn;
+    t->fiber_arg = arg;
+    fiber_stack_setup(t);
+
+    atomic_fetch_add_explicit(&s->active_tasks, 1, memory_order_relaxed);
+    sched_enqueue(s, t);
+
+    GreenHandle *h = (GreenHandle *)malloc(sizeof(GreenHandle));
+    if (!h) {
+        fprintf(stderr, "rask: green handle alloc failed\n");
+        abort();
+    }
+    h->task = t;
+    return h;
+}
+
+// Run a blocking C call on the pool while the calling fiber is parked.
+// Returns the call's result. Outside a fiber it just calls fn directly.
+int64_t rask_fiber_blocking(int64_t (*fn)(void *), void *arg) {
+    GreenTask *t = tl_fiber_task;
+    if (!t) {
+        return fn(arg);
+    }
+    t->fiber_op.kind     = FIBER_OP_BLOCKING;
+    t->fiber_op.call     = fn;
+    t->fiber_op.call_arg = arg;
+    fiber_suspend(t);
+    return t->io_result;
+}
+
 int64_t rask_green_join(void *handle) {
     GreenHandle *h = (GreenHandle *)handle;
     if (!h || !h->task) {
@@ -633,6 +1580,16 @@ void rask_yield_read(int fd, void *buf, size_t len) {
     GreenTask *t = tl_current_task;
     if (!s || !s->io || !t) return;
 
+    if (tl_fiber_task) {
+        // Fiber: defer the submit to the worker, suspend until completion.
+        // On resume the result is in t->io_result like the stackless path.
+        t->fiber_op.kind = FIBER_OP_READ;
+        t->fiber_op.fd   = fd;
+        t->fiber_op.buf  = buf;
+        t->fiber_op.len  = len;
+        fiber_suspend(t);
+        return;
+    }
     s->io->submit_read(s->io, fd, buf, len, io_completion_cb, t);
 }
 
@@ -641,34 +1598,89 @@ void rask_yield_write(int fd, const void *buf, size_t len) {
     GreenTask *t = tl_current_task;
     if (!s || !s->io || !t) return;
 
+    if (tl_fiber_task) {
+        t->fiber_op.kind = FIBER_OP_WRITE;
+        t->fiber_op.fd   = fd;
+        t->fiber_op.buf  = (void *)buf;
+        t->fiber_op.len  = len;
+        fiber_suspend(t);
+        return;
+    }
     s->io->submit_write(s->io, fd, buf, len, io_completion_cb, t);
 }
 
+void rask_yield_writev(int fd, const struct iovec *iov, int iovcnt) {
+    GreenScheduler *s = g_sched;
+    GreenTask *t = tl_current_task;
+    if (!s || !s->io || !t) return;
+
+    if (tl_fiber_task) {
+        t->fiber_op.kind   = FIBER_OP_WRITEV;
+        t->fiber_op.fd     = fd;
+        t->fiber_op.iov    = iov;
+        t->fiber_op.iovcnt = iovcnt;
+        fiber_suspend(t);
+        return;
+    }
+    s->io->submit_writev(s->io, fd, iov, iovcnt, io_completion_cb, t);
+}
+
+void rask_io_forget_fd(int fd) {
+    GreenScheduler *s = g_sched;
+    if (!s || !s->io || !s->io->forget_fd) return;
+
+    s->io->forget_fd(s->io, fd);
+}
+
 void rask_yield_accept(int listen_fd) {
     GreenScheduler *s = g_sched;
     GreenTask *t = tl_current_task;
     if (!s || !s->io || !t) return;
 
-    s->io->submit_accept(s->io, listen_fd, io_completion_cb, t);
+    if (tl_fiber_task) {
+        t->fiber_op.kind = FIBER_OP_ACCEPT;
+        t->fiber_op.fd   = listen_fd;
+        fiber_suspend(t);
+        return;
+    }
+    accept_begin(s, t, listen_fd);
 }
 
 void rask_yield_timeout(uint64_t ns) {
     GreenScheduler *s = g_sched;
     GreenTask *t = tl_current_task;
-    if (!s || !s->io || !t) return;
+    if (!s || !t) return;
 
-    s->io->submit_timeout(s->io, ns, io_completion_cb, t);
+    if (tl_fiber_task) {
+        t->fiber_op.kind = FIBER_OP_TIMEOUT;
+        t->fiber_op.ns   = ns;
+        fiber_suspend(t);
+        return;
+    }
+    // Timed waits go on the worker's own wheel — no kernel op per timer.
+    if (tl_worker_id >= 0 && tl_worker_id < s->worker_count) {
+        wheel_insert(&s->wheels[tl_worker_id], t, wheel_clock_ns() + ns);
+        return;
+    }
+    // Off-worker caller (shouldn't happen for state machines) — engine fallback
+    if (s->io) s->io->submit_timeout(s->io, ns, io_completion_cb, t);
 }
 
 void rask_yield(void) {
-    // Cooperative yield: re-enqueue via zero-timeout so the task gets
-    // polled again on the next I/O sweep. Falls back to direct re-enqueue
-    // if no I/O engine is available.
+    // Cooperative yield: park on the wheel's immediate list so the task
+    // gets re-enqueued after the current poll returns, not during it.
     GreenScheduler *s = g_sched;
     GreenTask *t = tl_current_task;
     if (!s || !t) return;
 
-    if (s->io) {
+    if (tl_fiber_task) {
+        t->fiber_op.kind = FIBER_OP_YIELD;
+        fiber_suspend(t);
+        return;
+    }
+    if (tl_worker_id >= 0 && tl_worker_id < s->worker_count) {
+        wheel_insert(&s->wheels[tl_worker_id], t, 0);
+    } else if (s->io) {
         s->io->submit_timeout(s->io, 0, io_completion_cb, t);
     } else {
         // No I/O engine — direct re-enqueue
@@ -731,23 +1743,49 @@ void *rask_threadpool_spawn(void *closure_ptr) {
 
 // ─── I/O wrappers ───────────────────────────────────────────
 //
-// Blocking syscall wrappers. Async I/O inside green tasks requires the
-// state machine to call rask_yield_read/write/accept directly and return
-// PENDING — the I/O completion callback re-enqueues the task with io_result
-// populated. These wrappers exist for non-green contexts and for use by
-// channel retry loops that handle yielding internally.
+// Inside a fiber these suspend through rask_yield_* — the worker submits
+// the op to the I/O engine and the completion callback re-enqueues the
+// fiber with io_result populated. Stackless state machines call
+// rask_yield_read/write/accept directly and return PENDING instead.
+// Outside any fiber (main thread, OS threads, channel retry loops) they
+// fall back to plain blocking syscalls.
 
 int64_t rask_async_read(int fd, void *buf, int64_t len) {
+    GreenTask *t = tl_fiber_task;
+    if (t) {
+        rask_yield_read(fd, buf, (size_t)len);
+        return t->io_result;
+    }
     ssize_t n = read(fd, buf, (size_t)len);
     return (int64_t)n;
 }
 
 int64_t rask_async_write(int fd, const void *buf, int64_t len) {
+    GreenTask *t = tl_fiber_task;
+    if (t) {
+        rask_yield_write(fd, buf, (size_t)len);
+        return t->io_result;
+    }
     ssize_t n = write(fd, buf, (size_t)len);
     return (int64_t)n;
 }
 
+int64_t rask_async_writev(int fd, const struct iovec *iov, int iovcnt) {
+    GreenTask *t = tl_fiber_task;
+    if (t) {
+        rask_yield_writev(fd, iov, iovcnt);
+        return t->io_result;
+    }
+    ssize_t n = writev(fd, iov, iovcnt);
+    return (int64_t)n;
+}
+
 int64_t rask_async_accept(int listen_fd) {
+    GreenTask *t = tl_fiber_task;
+    if (t) {
+        rask_yield_accept(listen_fd);
+        return t->io_result;
+    }
     int client = accept(listen_fd, NULL, NULL);
     return (int64_t)client;
 }
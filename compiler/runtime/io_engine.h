@@ -13,6 +13,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <sys/uio.h>
 
 // Callback signature: result is bytes transferred (or fd for accept),
 // err is errno on failure (0 on success).
@@ -25,8 +26,17 @@ struct RaskIoEngine {
                         rask_io_cb cb, void *ud);
     void (*submit_write)(RaskIoEngine *e, int fd, const void *buf, size_t len,
                          rask_io_cb cb, void *ud);
+    // Vectored write — iov must stay valid until the callback fires.
+    void (*submit_writev)(RaskIoEngine *e, int fd, const struct iovec *iov,
+                          int iovcnt, rask_io_cb cb, void *ud);
     void (*submit_accept)(RaskIoEngine *e, int listen_fd,
                           rask_io_cb cb, void *ud);
+    // Multishot accept: one submission, a stream of completions — cb fires
+    // once per accepted connection (result = client fd) and stays armed.
+    // A firing with result -1 terminates the stream (err ECANCELED after
+    // forget_fd, otherwise the accept failure).
+    void (*submit_accept_multi)(RaskIoEngine *e, int listen_fd,
+                                rask_io_cb cb, void *ud);
     void (*submit_timeout)(RaskIoEngine *e, uint64_t ns,
                            rask_io_cb cb, void *ud);
 
@@ -37,6 +47,11 @@ struct RaskIoEngine {
     // Pending operation count (for shutdown draining).
     int (*pending)(RaskIoEngine *e);
 
+    // Drop backend state tied to fd before it closes (fixed-file slots)
+    // and cancel any multishot accept armed on it.
+    // Optional — NULL when the backend keeps no per-fd registration.
+    void (*forget_fd)(RaskIoEngine *e, int fd);
+
     void (*destroy)(RaskIoEngine *e);
 };
 
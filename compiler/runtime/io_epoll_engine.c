@@ -12,6 +12,7 @@
 
 #include "io_engine.h"
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
@@ -28,15 +29,17 @@
 typedef enum {
     OP_READ,
     OP_WRITE,
+    OP_WRITEV,
     OP_ACCEPT,
+    OP_ACCEPT_MULTI,
     OP_TIMEOUT,
 } OpType;
 
 typedef struct PendingOp {
     OpType        type;
     int           fd;        // -1 for timeout
-    void         *buf;
-    size_t        len;
+    void         *buf;       // iov pointer for OP_WRITEV
+    size_t        len;       // iovcnt for OP_WRITEV
     rask_io_cb    cb;
     void         *ud;
     uint64_t      deadline_ns;  // for timeouts (CLOCK_MONOTONIC)
@@ -143,6 +146,37 @@ static void epoll_submit_write(RaskIoEngine *e, int fd, const void *buf,
     pthread_mutex_unlock(&ee->lock);
 }
 
+static void epoll_submit_writev(RaskIoEngine *e, int fd,
+                                 const struct iovec *iov, int iovcnt,
+                                 rask_io_cb cb, void *ud) {
+    EpollEngine *ee = (EpollEngine *)e;
+    set_nonblocking(fd);
+
+    ssize_t n = writev(fd, iov, iovcnt);
+    if (n >= 0) { cb(ud, n, 0); return; }
+    if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        cb(ud, -1, errno); return;
+    }
+
+    PendingOp *op = (PendingOp *)malloc(sizeof(PendingOp));
+    if (!op) { cb(ud, -1, ENOMEM); return; }
+    op->type = OP_WRITEV;
+    op->fd   = fd;
+    op->buf  = (void *)iov;
+    op->len  = (size_t)iovcnt;
+    op->cb   = cb;
+    op->ud   = ud;
+    op->next = NULL;
+
+    pthread_mutex_lock(&ee->lock);
+    if (fd >= 0 && fd < MAX_FDS) {
+        ee->fd_ops[fd] = op;
+    }
+    register_fd(ee, fd, EPOLLOUT);
+    atomic_fetch_add_explicit(&ee->pending_count, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&ee->lock);
+}
+
 static void epoll_submit_accept(RaskIoEngine *e, int listen_fd,
                                  rask_io_cb cb, void *ud) {
     EpollEngine *ee = (EpollEngine *)e;
@@ -173,6 +207,48 @@ static void epoll_submit_accept(RaskIoEngine *e, int listen_fd,
     pthread_mutex_unlock(&ee->lock);
 }
 
+// Drain accept() until EAGAIN, firing cb once per connection.
+// Returns 0 to stay armed, negative errno on terminal failure.
+static int drain_accepts(PendingOp *op) {
+    for (;;) {
+        int client = accept4(op->fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (client < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) return 0;
+            return -errno;
+        }
+        op->cb(op->ud, client, 0);
+    }
+}
+
+// Multishot emulation: drain the backlog on every EPOLLIN, stay registered.
+static void epoll_submit_accept_multi(RaskIoEngine *e, int listen_fd,
+                                       rask_io_cb cb, void *ud) {
+    EpollEngine *ee = (EpollEngine *)e;
+    set_nonblocking(listen_fd);
+
+    PendingOp *op = (PendingOp *)malloc(sizeof(PendingOp));
+    if (!op) { cb(ud, -1, ENOMEM); return; }
+    op->type = OP_ACCEPT_MULTI;
+    op->fd   = listen_fd;
+    op->buf  = NULL;
+    op->len  = 0;
+    op->cb   = cb;
+    op->ud   = ud;
+    op->next = NULL;
+
+    // Accept whatever is already queued before arming
+    int rc = drain_accepts(op);
+    if (rc < 0) { cb(ud, -1, -rc); free(op); return; }
+
+    pthread_mutex_lock(&ee->lock);
+    if (listen_fd >= 0 && listen_fd < MAX_FDS) {
+        ee->fd_ops[listen_fd] = op;
+    }
+    register_fd(ee, listen_fd, EPOLLIN);
+    atomic_fetch_add_explicit(&ee->pending_count, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&ee->lock);
+}
+
 static void epoll_submit_timeout(RaskIoEngine *e, uint64_t ns,
                                   rask_io_cb cb, void *ud) {
     EpollEngine *ee = (EpollEngine *)e;
@@ -220,6 +296,14 @@ static void retry_op(EpollEngine *ee __attribute__((unused)), PendingOp *op) {
             op->cb(op->ud, -1, errno);
         }
         break;
+    case OP_WRITEV:
+        n = writev(op->fd, (const struct iovec *)op->buf, (int)op->len);
+        if (n >= 0) {
+            op->cb(op->ud, n, 0);
+        } else {
+            op->cb(op->ud, -1, errno);
+        }
+        break;
     case OP_ACCEPT: {
         int client = accept4(op->fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
         if (client >= 0) {
@@ -282,6 +366,29 @@ static int epoll_io_poll(RaskIoEngine *e, int timeout_ms) {
         PendingOp *op = ee->fd_ops[fd];
         if (!op) continue;
 
+        // Multishot accept: drain the backlog, then stay armed
+        // (EPOLLONESHOT disarmed the fd, so re-register).
+        if (op->type == OP_ACCEPT_MULTI) {
+            ee->fd_ops[fd] = NULL;
+            pthread_mutex_unlock(&ee->lock);
+            int rc = drain_accepts(op);
+            pthread_mutex_lock(&ee->lock);
+            fired++;
+            if (rc < 0) {
+                epoll_ctl(ee->epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+                atomic_fetch_sub_explicit(&ee->pending_count, 1,
+                                           memory_order_relaxed);
+                pthread_mutex_unlock(&ee->lock);
+                op->cb(op->ud, -1, -rc);
+                free(op);
+                pthread_mutex_lock(&ee->lock);
+            } else if (ee->fd_ops[fd] == NULL) {
+                ee->fd_ops[fd] = op;
+                register_fd(ee, fd, EPOLLIN);
+            }
+            continue;
+        }
+
         ee->fd_ops[fd] = NULL;
         epoll_ctl(ee->epoll_fd, EPOLL_CTL_DEL, fd, NULL);
         atomic_fetch_sub_explicit(&ee->pending_count, 1, memory_order_relaxed);
@@ -313,6 +420,24 @@ static int epoll_io_poll(RaskIoEngine *e, int timeout_ms) {
     return fired;
 }
 
+// Cancel any pending op on a closing fd. The callback fires once more
+// with ECANCELED so a multishot consumer sees its stream end.
+static void epoll_forget_fd(RaskIoEngine *e, int fd) {
+    EpollEngine *ee = (EpollEngine *)e;
+    if (fd < 0 || fd >= MAX_FDS) return;
+
+    pthread_mutex_lock(&ee->lock);
+    PendingOp *op = ee->fd_ops[fd];
+    if (!op) { pthread_mutex_unlock(&ee->lock); return; }
+    ee->fd_ops[fd] = NULL;
+    epoll_ctl(ee->epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+    atomic_fetch_sub_explicit(&ee->pending_count, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&ee->lock);
+
+    op->cb(op->ud, -1, ECANCELED);
+    free(op);
+}
+
 static int epoll_io_pending(RaskIoEngine *e) {
     EpollEngine *ee = (EpollEngine *)e;
     return atomic_load_explicit(&ee->pending_count, memory_order_relaxed);
@@ -359,10 +484,13 @@ RaskIoEngine *rask_io_create_epoll(void) {
 
     ee->base.submit_read    = epoll_submit_read;
     ee->base.submit_write   = epoll_submit_write;
+    ee->base.submit_writev  = epoll_submit_writev;
     ee->base.submit_accept  = epoll_submit_accept;
+    ee->base.submit_accept_multi = epoll_submit_accept_multi;
     ee->base.submit_timeout = epoll_submit_timeout;
     ee->base.poll           = epoll_io_poll;
     ee->base.pending        = epoll_io_pending;
+    ee->base.forget_fd      = epoll_forget_fd;
     ee->base.destroy        = epoll_destroy;
 
     return &ee->base;
@@ -371,6 +499,18 @@ RaskIoEngine *rask_io_create_epoll(void) {
 // ─── Auto-detect ────────────────────────────────────────────
 
 RaskIoEngine *rask_io_create(void) {
+    // RASK_IO_ENGINE=uring|epoll pins a backend (benchmarking, debugging)
+    const char *force = getenv("RASK_IO_ENGINE");
+    if (force && strcmp(force, "epoll") == 0) {
+        return rask_io_create_epoll();
+    }
+    if (force && strcmp(force, "uring") == 0) {
+        RaskIoEngine *e = rask_io_create_uring();
+        if (e) return e;
+        fprintf(stderr, "rask: RASK_IO_ENGINE=uring but io_uring unavailable, using epoll\n");
+        return rask_io_create_epoll();
+    }
+
     // Try io_uring first
     RaskIoEngine *e = rask_io_create_uring();
     if (e) return e;
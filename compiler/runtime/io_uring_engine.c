@@ -32,17 +32,49 @@ static int io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
                         flags, NULL, 0);
 }
 
+static int io_uring_register(int fd, unsigned opcode, void *arg,
+                             unsigned nr_args) {
+    return (int)syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
 // ─── Completion callback storage ────────────────────────────
 
 typedef struct {
     rask_io_cb cb;
     void      *ud;
+    // Registered-buffer bounce state: -1 = caller's own buffer
+    int        fixed_buf;
+    int        is_read;
+    void      *user_buf;
+    size_t     user_len;
+    // Multishot accept: 0 = single-shot op, 1 = kernel multishot,
+    // 2 = emulated via re-armed single-shot accepts (pre-5.19 kernel)
+    int        multishot;
+    int        ms_fd;     // listen fd for re-arming
 } IoOp;
 
+// Multishot accept needs 5.19+; older headers may lack the constants.
+#ifndef IORING_ACCEPT_MULTISHOT
+#define IORING_ACCEPT_MULTISHOT (1U << 0)
+#endif
+#ifndef IORING_CQE_F_MORE
+#define IORING_CQE_F_MORE (1U << 1)
+#endif
+
 // ─── Engine state ───────────────────────────────────────────
 
 #define URING_ENTRIES 256
 
+// Registered buffer pool: small ops bounce through pre-registered
+// buffers (READ_FIXED/WRITE_FIXED) to skip per-op kernel buffer
+// mapping. One memcpy per op, saved page-pinning per op.
+#define FIXED_BUF_COUNT 64
+#define FIXED_BUF_SIZE  8192
+
+// Fixed-file table: long-lived sockets get registered slots so the
+// kernel skips the fdtable lookup + refcount per op.
+#define FIXED_FILE_COUNT 64
+
 typedef struct {
     RaskIoEngine  base;
     int           ring_fd;
@@ -79,6 +111,16 @@ typedef struct {
     // Matches struct __kernel_timespec layout but avoids header dependency.
     struct { int64_t tv_sec; long long tv_nsec; } timeouts[URING_ENTRIES];
 
+    // Registered buffers (NULL slab = registration unavailable)
+    char         *buf_slab;
+    uint32_t      buf_free[FIXED_BUF_COUNT];
+    int           buf_free_top;
+
+    // Fixed files: slot_fds[i] = fd registered in slot i, -1 = empty.
+    // files_enabled = sparse table registration succeeded at setup.
+    int           slot_fds[FIXED_FILE_COUNT];
+    int           files_enabled;
+
     // Protects SQ/CQ ring access and slot allocation from concurrent workers.
     pthread_mutex_t lock;
 } UringEngine;
@@ -87,7 +129,10 @@ typedef struct {
 
 static int alloc_slot(UringEngine *ue) {
     if (ue->free_top <= 0) return -1;
-    return (int)ue->free_slots[--ue->free_top];
+    int slot = (int)ue->free_slots[--ue->free_top];
+    ue->ops[slot].fixed_buf = -1;
+    ue->ops[slot].multishot = 0;
+    return slot;
 }
 
 static void free_slot(UringEngine *ue, uint32_t slot) {
@@ -120,6 +165,77 @@ static int flush_sq(UringEngine *ue) {
     return ret >= 0 ? ret : 0;
 }
 
+// ─── Registered buffer / fixed file helpers ─────────────────
+// alloc/release/slot helpers run with ue->lock held.
+
+static int alloc_fixed_buf(UringEngine *ue, size_t len) {
+    if (!ue->buf_slab || len > FIXED_BUF_SIZE || ue->buf_free_top <= 0)
+        return -1;
+    return (int)ue->buf_free[--ue->buf_free_top];
+}
+
+static void release_fixed_buf(UringEngine *ue, int buf) {
+    ue->buf_free[ue->buf_free_top++] = (uint32_t)buf;
+}
+
+// Slot for fd in the fixed-file table, registering it on first use.
+// Returns -1 when disabled or the table is full (caller uses the raw fd).
+static int fixed_file_slot(UringEngine *ue, int fd) {
+    if (!ue->files_enabled) return -1;
+    int empty = -1;
+    for (int i = 0; i < FIXED_FILE_COUNT; i++) {
+        if (ue->slot_fds[i] == fd) return i;
+        if (empty < 0 && ue->slot_fds[i] < 0) empty = i;
+    }
+    if (empty < 0) return -1;
+    struct io_uring_files_update upd = {
+        .offset = (uint32_t)empty,
+        .fds    = (uint64_t)(uintptr_t)&fd,
+    };
+    if (io_uring_register(ue->ring_fd, IORING_REGISTER_FILES_UPDATE, &upd, 1) < 0)
+        return -1;
+    ue->slot_fds[empty] = fd;
+    return empty;
+}
+
+// Drop a closing fd from the fixed-file table. Must run before the fd
+// number can be reused — the registered slot pins the old description.
+static void uring_forget_fd(RaskIoEngine *e, int fd) {
+    UringEngine *ue = (UringEngine *)e;
+    pthread_mutex_lock(&ue->lock);
+
+    if (ue->files_enabled) {
+        for (int i = 0; i < FIXED_FILE_COUNT; i++) {
+            if (ue->slot_fds[i] == fd) {
+                int minus_one = -1;
+                struct io_uring_files_update upd = {
+                    .offset = (uint32_t)i,
+                    .fds    = (uint64_t)(uintptr_t)&minus_one,
+                };
+                io_uring_register(ue->ring_fd, IORING_REGISTER_FILES_UPDATE, &upd, 1);
+                ue->slot_fds[i] = -1;
+                break;
+            }
+        }
+    }
+
+    // Cancel a multishot accept armed on this fd; its -ECANCELED
+    // completion fires the terminal callback and releases the slot.
+    for (uint32_t i = 0; i < URING_ENTRIES; i++) {
+        if (ue->ops[i].cb && ue->ops[i].multishot && ue->ops[i].ms_fd == fd) {
+            struct io_uring_sqe *sqe = get_sqe(ue);
+            if (!sqe) break;
+            sqe->opcode    = IORING_OP_ASYNC_CANCEL;
+            sqe->fd        = -1;
+            sqe->addr      = (uint64_t)i;
+            sqe->user_data = (uint64_t)-1; // slot check in poll skips this CQE
+            flush_sq(ue);
+        }
+    }
+
+    pthread_mutex_unlock(&ue->lock);
+}
+
 // ─── Submit operations ──────────────────────────────────────
 
 static void uring_submit_read(RaskIoEngine *e, int fd, void *buf, size_t len,
@@ -136,9 +252,27 @@ static void uring_submit_read(RaskIoEngine *e, int fd, void *buf, size_t len,
     struct io_uring_sqe *sqe = get_sqe(ue);
     if (!sqe) { free_slot(ue, (uint32_t)slot); pthread_mutex_unlock(&ue->lock); cb(ud, -1, ENOMEM); return; }
 
-    sqe->opcode  = IORING_OP_READ;
-    sqe->fd      = fd;
-    sqe->addr    = (uint64_t)(uintptr_t)buf;
+    int fbuf = alloc_fixed_buf(ue, len);
+    ue->ops[slot].fixed_buf = fbuf;
+    ue->ops[slot].is_read   = 1;
+    ue->ops[slot].user_buf  = buf;
+    ue->ops[slot].user_len  = len;
+
+    if (fbuf >= 0) {
+        sqe->opcode    = IORING_OP_READ_FIXED;
+        sqe->addr      = (uint64_t)(uintptr_t)(ue->buf_slab + (size_t)fbuf * FIXED_BUF_SIZE);
+        sqe->buf_index = (uint16_t)fbuf;
+    } else {
+        sqe->opcode = IORING_OP_READ;
+        sqe->addr   = (uint64_t)(uintptr_t)buf;
+    }
+    int fslot = fixed_file_slot(ue, fd);
+    if (fslot >= 0) {
+        sqe->fd    = fslot;
+        sqe->flags |= IOSQE_FIXED_FILE;
+    } else {
+        sqe->fd = fd;
+    }
     sqe->len     = (uint32_t)len;
     sqe->off     = (uint64_t)-1; // current file position
     sqe->user_data = (uint64_t)slot;
@@ -162,9 +296,29 @@ static void uring_submit_write(RaskIoEngine *e, int fd, const void *buf,
     struct io_uring_sqe *sqe = get_sqe(ue);
     if (!sqe) { free_slot(ue, (uint32_t)slot); pthread_mutex_unlock(&ue->lock); cb(ud, -1, ENOMEM); return; }
 
-    sqe->opcode  = IORING_OP_WRITE;
-    sqe->fd      = fd;
-    sqe->addr    = (uint64_t)(uintptr_t)buf;
+    int fbuf = alloc_fixed_buf(ue, len);
+    ue->ops[slot].fixed_buf = fbuf;
+    ue->ops[slot].is_read   = 0;
+    ue->ops[slot].user_buf  = NULL;
+    ue->ops[slot].user_len  = len;
+
+    if (fbuf >= 0) {
+        char *fb = ue->buf_slab + (size_t)fbuf * FIXED_BUF_SIZE;
+        memcpy(fb, buf, len);
+        sqe->opcode    = IORING_OP_WRITE_FIXED;
+        sqe->addr      = (uint64_t)(uintptr_t)fb;
+        sqe->buf_index = (uint16_t)fbuf;
+    } else {
+        sqe->opcode = IORING_OP_WRITE;
+        sqe->addr   = (uint64_t)(uintptr_t)buf;
+    }
+    int fslot = fixed_file_slot(ue, fd);
+    if (fslot >= 0) {
+        sqe->fd    = fslot;
+        sqe->flags |= IOSQE_FIXED_FILE;
+    } else {
+        sqe->fd = fd;
+    }
     sqe->len     = (uint32_t)len;
     sqe->off     = (uint64_t)-1;
     sqe->user_data = (uint64_t)slot;
@@ -174,6 +328,33 @@ static void uring_submit_write(RaskIoEngine *e, int fd, const void *buf,
     pthread_mutex_unlock(&ue->lock);
 }
 
+static void uring_submit_writev(RaskIoEngine *e, int fd,
+                                 const struct iovec *iov, int iovcnt,
+                                 rask_io_cb cb, void *ud) {
+    UringEngine *ue = (UringEngine *)e;
+    pthread_mutex_lock(&ue->lock);
+
+    int slot = alloc_slot(ue);
+    if (slot < 0) { pthread_mutex_unlock(&ue->lock); cb(ud, -1, ENOMEM); return; }
+
+    ue->ops[slot].cb = cb;
+    ue->ops[slot].ud = ud;
+
+    struct io_uring_sqe *sqe = get_sqe(ue);
+    if (!sqe) { free_slot(ue, (uint32_t)slot); pthread_mutex_unlock(&ue->lock); cb(ud, -1, ENOMEM); return; }
+
+    sqe->opcode  = IORING_OP_WRITEV;
+    sqe->fd      = fd;
+    sqe->addr    = (uint64_t)(uintptr_t)iov;
+    sqe->len     = (uint32_t)iovcnt;
+    sqe->off     = (uint64_t)-1;
+    sqe->user_data = (uint64_t)slot;
+
+    atomic_fetch_add_explicit(&ue->pending_count, 1, memory_order_relaxed);
+    flush_sq(ue);
+    pthread_mutex_unlock(&ue->lock);
+}
+
 static void uring_submit_accept(RaskIoEngine *e, int listen_fd,
                                  rask_io_cb cb, void *ud) {
     UringEngine *ue = (UringEngine *)e;
@@ -199,6 +380,46 @@ static void uring_submit_accept(RaskIoEngine *e, int listen_fd,
     pthread_mutex_unlock(&ue->lock);
 }
 
+// Resubmit a (terminated or emulated) multishot accept from its slot.
+// Lock held. Returns -1 when the SQ is full.
+static int rearm_accept(UringEngine *ue, uint32_t slot) {
+    struct io_uring_sqe *sqe = get_sqe(ue);
+    if (!sqe) return -1;
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd     = ue->ops[slot].ms_fd;
+    if (ue->ops[slot].multishot == 1)
+        sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe->user_data = (uint64_t)slot;
+    flush_sq(ue);
+    return 0;
+}
+
+static void uring_submit_accept_multi(RaskIoEngine *e, int listen_fd,
+                                       rask_io_cb cb, void *ud) {
+    UringEngine *ue = (UringEngine *)e;
+    pthread_mutex_lock(&ue->lock);
+
+    int slot = alloc_slot(ue);
+    if (slot < 0) { pthread_mutex_unlock(&ue->lock); cb(ud, -1, ENOMEM); return; }
+
+    ue->ops[slot].cb = cb;
+    ue->ops[slot].ud = ud;
+    ue->ops[slot].multishot = 1;
+    ue->ops[slot].ms_fd     = listen_fd;
+
+    struct io_uring_sqe *sqe = get_sqe(ue);
+    if (!sqe) { free_slot(ue, (uint32_t)slot); pthread_mutex_unlock(&ue->lock); cb(ud, -1, ENOMEM); return; }
+
+    sqe->opcode  = IORING_OP_ACCEPT;
+    sqe->fd      = listen_fd;
+    sqe->ioprio  = IORING_ACCEPT_MULTISHOT;
+    sqe->user_data = (uint64_t)slot;
+
+    atomic_fetch_add_explicit(&ue->pending_count, 1, memory_order_relaxed);
+    flush_sq(ue);
+    pthread_mutex_unlock(&ue->lock);
+}
+
 static void uring_submit_timeout(RaskIoEngine *e, uint64_t ns,
                                   rask_io_cb cb, void *ud) {
     UringEngine *ue = (UringEngine *)e;
@@ -257,19 +478,70 @@ static int uring_poll(RaskIoEngine *e, int timeout_ms) {
         void *ud = NULL;
         int64_t result = 0;
         int err = 0;
+        int also_terminal = 0; // fd delivered but stream ended (re-arm failed)
 
         if (slot < URING_ENTRIES && ue->ops[slot].cb) {
-            cb = ue->ops[slot].cb;
-            ud = ue->ops[slot].ud;
-            result = cqe->res;
-            if (cqe->res < 0) {
-                err = -(int)cqe->res;
-                result = -1;
+            IoOp *op = &ue->ops[slot];
+            if (op->multishot) {
+                int armed = 1;
+                if (cqe->res >= 0) {
+                    cb = op->cb;
+                    ud = op->ud;
+                    result = cqe->res;
+                    // Kernel keeps the op armed while F_MORE is set; when
+                    // it stops (or in emulated mode) resubmit this slot.
+                    if (!(cqe->flags & IORING_CQE_F_MORE) &&
+                        rearm_accept(ue, slot) < 0) {
+                        armed = 0;
+                        also_terminal = 1;
+                    }
+                } else if (op->multishot == 1 && cqe->res == -EINVAL) {
+                    // Pre-5.19 kernel rejects IORING_ACCEPT_MULTISHOT —
+                    // downgrade to re-armed single-shot accepts.
+                    op->multishot = 2;
+                    if (rearm_accept(ue, slot) < 0) {
+                        armed = 0;
+                        cb = op->cb;
+                        ud = op->ud;
+                        result = -1;
+                        err = ENOMEM;
+                    }
+                } else {
+                    armed = 0;
+                    cb = op->cb;
+                    ud = op->ud;
+                    result = -1;
+                    err = -(int)cqe->res;
+                }
+                if (!armed) {
+                    op->cb = NULL;
+                    free_slot(ue, slot);
+                    atomic_fetch_sub_explicit(&ue->pending_count, 1,
+                                               memory_order_relaxed);
+                }
+            } else {
+                cb = op->cb;
+                ud = op->ud;
+                result = cqe->res;
+                if (cqe->res < 0) {
+                    err = -(int)cqe->res;
+                    result = -1;
+                }
+                int fbuf = op->fixed_buf;
+                if (fbuf >= 0) {
+                    if (op->is_read && cqe->res > 0) {
+                        size_t n = (size_t)cqe->res;
+                        if (n > op->user_len) n = op->user_len;
+                        memcpy(op->user_buf,
+                               ue->buf_slab + (size_t)fbuf * FIXED_BUF_SIZE, n);
+                    }
+                    release_fixed_buf(ue, fbuf);
+                }
+                op->cb = NULL;
+                free_slot(ue, slot);
+                atomic_fetch_sub_explicit(&ue->pending_count, 1,
+                                           memory_order_relaxed);
             }
-            ue->ops[slot].cb = NULL;
-            free_slot(ue, slot);
-            atomic_fetch_sub_explicit(&ue->pending_count, 1,
-                                       memory_order_relaxed);
         }
 
         atomic_store_explicit((_Atomic uint32_t *)ue->cq_head, head + 1,
@@ -280,6 +552,8 @@ static int uring_poll(RaskIoEngine *e, int timeout_ms) {
         if (cb) {
             pthread_mutex_unlock(&ue->lock);
             cb(ud, result, err);
+            if (also_terminal)
+                cb(ud, -1, ENOMEM);
             pthread_mutex_lock(&ue->lock);
         }
     }
@@ -298,6 +572,7 @@ static int uring_pending(RaskIoEngine *e) {
 static void uring_destroy(RaskIoEngine *e) {
     UringEngine *ue = (UringEngine *)e;
     pthread_mutex_destroy(&ue->lock);
+    free(ue->buf_slab);
     if (ue->sq_ring_ptr)
         munmap(ue->sq_ring_ptr, ue->sq_ring_size);
     if (ue->cq_ring_ptr && ue->cq_ring_ptr != ue->sq_ring_ptr)
@@ -369,13 +644,46 @@ RaskIoEngine *rask_io_create_uring(void) {
         ue->free_slots[i] = (uint32_t)i;
     }
 
+    // Register bounce buffers. Best-effort: locked-memory limits or old
+    // kernels just leave buf_slab NULL and ops use plain READ/WRITE.
+    ue->buf_slab = (char *)malloc((size_t)FIXED_BUF_COUNT * FIXED_BUF_SIZE);
+    if (ue->buf_slab) {
+        struct iovec bufs[FIXED_BUF_COUNT];
+        for (int i = 0; i < FIXED_BUF_COUNT; i++) {
+            bufs[i].iov_base = ue->buf_slab + (size_t)i * FIXED_BUF_SIZE;
+            bufs[i].iov_len  = FIXED_BUF_SIZE;
+        }
+        if (io_uring_register(fd, IORING_REGISTER_BUFFERS, bufs,
+                              FIXED_BUF_COUNT) < 0) {
+            free(ue->buf_slab);
+            ue->buf_slab = NULL;
+        } else {
+            ue->buf_free_top = FIXED_BUF_COUNT;
+            for (int i = 0; i < FIXED_BUF_COUNT; i++)
+                ue->buf_free[i] = (uint32_t)i;
+        }
+    }
+
+    // Register a sparse fixed-file table (slots filled lazily per fd).
+    for (int i = 0; i < FIXED_FILE_COUNT; i++)
+        ue->slot_fds[i] = -1;
+    {
+        int empty_fds[FIXED_FILE_COUNT];
+        for (int i = 0; i < FIXED_FILE_COUNT; i++) empty_fds[i] = -1;
+        ue->files_enabled = io_uring_register(fd, IORING_REGISTER_FILES,
+                                              empty_fds, FIXED_FILE_COUNT) == 0;
+    }
+
     // Wire up vtable
     ue->base.submit_read    = uring_submit_read;
     ue->base.submit_write   = uring_submit_write;
+    ue->base.submit_writev  = uring_submit_writev;
     ue->base.submit_accept  = uring_submit_accept;
+    ue->base.submit_accept_multi = uring_submit_accept_multi;
     ue->base.submit_timeout = uring_submit_timeout;
     ue->base.poll           = uring_poll;
     ue->base.pending        = uring_pending;
+    ue->base.forget_fd      = uring_forget_fd;
     ue->base.destroy        = uring_destroy;
 
     return &ue->base;
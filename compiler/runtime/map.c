@@ -1,61 +1,145 @@
 // SPDX-License-Identifier: (MIT OR Apache-2.0)
 
-// Map — open-addressing hash map with linear probing.
-// Separate arrays for slot states, keys, and values.
-// Default hash: FNV-1a. Default equality: memcmp.
+// Map — open-addressing hash map with SwissTable-style group probing.
+// Separate arrays for control bytes, keys, and values.
+// Default hash: word-at-a-time multiply-mix (wyhash-class), seeded per
+// process. Default equality: memcmp.
+//
+// Control bytes: a FULL slot stores the top 7 bits of the key's hash
+// (its "tag"); EMPTY and TOMBSTONE have the high bit set. Probing scans
+// 8 control bytes at a time with SWAR bit tricks, so one 64-bit load
+// filters a whole group — eq_fn only runs on tag matches (1/128 false
+// positive rate).
+//
+// Growth is incremental: begin_rehash allocates the new tables and
+// leaves the old ones in place; each insert/remove migrates a bounded
+// number of slots, so no single operation pays for a full rehash.
+// While both tables coexist, a key lives in exactly one of them —
+// migrated old slots become tombstones so probe chains stay intact.
 
 #include "rask_runtime.h"
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
-#define MAP_EMPTY     0
-#define MAP_OCCUPIED  1
-#define MAP_TOMBSTONE 2
+#define MAP_EMPTY     0x80
+#define MAP_TOMBSTONE 0xFE
+#define MAP_IS_FULL(b) (((b) & 0x80) == 0)
+
+#define MAP_GROUP 8
 
 #define MAP_INITIAL_CAP 16
 #define MAP_LOAD_MAX_NUM 3  // load factor = 3/4 = 0.75
 #define MAP_LOAD_MAX_DEN 4
 
+// Slots migrated per mutating operation during incremental rehash.
+// At 0.75 load a rehash must finish within ~0.75*cap inserts; 32 slots
+// per op clears the old table in cap/32 ops — a wide margin.
+#define MAP_MIGRATE_SLOTS 32
+
 struct RaskMap {
     int64_t    key_size;
     int64_t    val_size;
     int64_t    cap;
-    int64_t    len;
-    int64_t    tombstones;
+    int64_t    len;          // live entries across both tables
+    int64_t    tombstones;   // new-table tombstones only
     uint8_t   *states;
     char      *keys;
     char      *vals;
+    // Old tables during incremental rehash (NULL when not rehashing)
+    int64_t    old_cap;
+    int64_t    migrate_pos;  // next old-table slot to migrate
+    uint8_t   *old_states;
+    char      *old_keys;
+    char      *old_vals;
     RaskHashFn hash_fn;
     RaskEqFn   eq_fn;
 };
 
 // ─── Built-in hash/eq ───────────────────────────────────────
 
-uint64_t rask_hash_bytes(const void *key, int64_t key_size) {
+// Word-at-a-time hash: 8 bytes per step through a 128-bit multiply mix
+// instead of FNV-1a's byte loop — hashing a 64-byte key is 8 mixes, not
+// 64. Seeded once per process (clock + ASLR) so hash values aren't
+// predictable or stable across runs.
+
+#define HASH_K0 0x2d358dccaa6c78a5ULL
+#define HASH_K1 0x8bb84b93962eacc9ULL
+
+static uint64_t map_hash_seed = HASH_K1;  // fallback if constructor doesn't run
+
+static uint64_t mum(uint64_t a, uint64_t b) {
+    __uint128_t r = (__uint128_t)a * b;
+    return (uint64_t)r ^ (uint64_t)(r >> 64);
+}
+
+__attribute__((constructor))
+static void map_seed_init(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t s = (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+    s ^= (uint64_t)(uintptr_t)&map_hash_seed;
+    map_hash_seed = mum(s ^ HASH_K0, HASH_K1) | 1;
+}
+
+static uint64_t load64(const uint8_t *p) { uint64_t v; memcpy(&v, p, 8); return v; }
+static uint64_t load32(const uint8_t *p) { uint32_t v; memcpy(&v, p, 4); return v; }
+
+static uint64_t hash_words(const void *key, int64_t len) {
     const uint8_t *p = (const uint8_t *)key;
-    uint64_t h = 0xcbf29ce484222325ULL;
-    for (int64_t i = 0; i < key_size; i++) {
-        h ^= p[i];
-        h *= 0x100000001b3ULL;
+    uint64_t seed = map_hash_seed;
+    uint64_t a, b;
+
+    if (len <= 8) {
+        if (len >= 4) {
+            // Two overlapping 4-byte reads cover 4..8 bytes
+            a = load32(p);
+            b = load32(p + len - 4);
+        } else if (len > 0) {
+            // First, middle, last byte
+            a = ((uint64_t)p[0] << 16) | ((uint64_t)p[len >> 1] << 8) | p[len - 1];
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else if (len <= 16) {
+        a = load64(p);
+        b = load64(p + len - 8);
+    } else {
+        int64_t i = len;
+        while (i > 16) {
+            seed = mum(load64(p) ^ HASH_K0, load64(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+        // Overlapping tail read of the last 16 bytes
+        a = load64(p + i - 16);
+        b = load64(p + i - 8);
     }
-    return h;
+    uint64_t h = mum(HASH_K0 ^ (uint64_t)len, mum(a ^ HASH_K1, b ^ seed));
+    // 0 is reserved as "not computed" in string hash caches
+    return h ? h : HASH_K0;
+}
+
+uint64_t rask_hash_bytes(const void *key, int64_t key_size) {
+    return hash_words(key, key_size);
 }
 
 int rask_eq_bytes(const void *a, const void *b, int64_t key_size) {
     return memcmp(a, b, (size_t)key_size) == 0;
 }
 
-// String-keyed maps: key slot holds a 16-byte RaskStr value, hash/eq use string content
+// String-keyed maps: key slot holds a 16-byte RaskStr value, hash/eq use
+// string content. Heap strings cache the hash in their header — repeat
+// lookups with a long key cost a load instead of a pass over the bytes.
 uint64_t rask_hash_string_key(const void *key, int64_t key_size) {
     (void)key_size;
     const RaskStr *s = (const RaskStr *)key;
-    int64_t len = rask_string_len(s);
-    const char *data = rask_string_ptr(s);
-    uint64_t h = 0xcbf29ce484222325ULL;
-    for (int64_t i = 0; i < len; i++) {
-        h ^= (uint8_t)data[i];
-        h *= 0x100000001b3ULL;
-    }
+    uint64_t *slot = rask_string_hash_slot(s);
+    if (slot && *slot) return *slot;
+    uint64_t h = hash_words(rask_string_bytes(s), rask_string_len(s));
+    if (slot) *slot = h;
     return h;
 }
 
@@ -68,7 +152,7 @@ int rask_eq_string_key(const void *a, const void *b, int64_t key_size) {
     int64_t la = rask_string_len(sa);
     int64_t lb = rask_string_len(sb);
     if (la != lb) return 0;
-    return memcmp(rask_string_ptr(sa), rask_string_ptr(sb), (size_t)la) == 0;
+    return memcmp(rask_string_bytes(sa), rask_string_bytes(sb), (size_t)la) == 0;
 }
 
 // ─── Internal ───────────────────────────────────────────────
@@ -81,51 +165,106 @@ static void map_alloc_tables(RaskMap *m, int64_t cap) {
     m->vals = (char *)rask_alloc(rask_safe_mul(cap, m->val_size));
 }
 
-static int64_t map_find_slot(const RaskMap *m, const void *key) {
-    uint64_t h = m->hash_fn(key, m->key_size);
-    int64_t idx = (int64_t)(h % (uint64_t)m->cap);
-    int64_t first_tombstone = -1;
+static uint8_t map_tag(uint64_t h) {
+    return (uint8_t)((h >> 57) & 0x7F);
+}
 
-    for (int64_t i = 0; i < m->cap; i++) {
-        int64_t slot = (idx + i) % m->cap;
-        uint8_t state = m->states[slot];
+// SWAR: high bit set in every byte of `group` equal to `tag`.
+// Byte order maps to slot order on little-endian targets (all current
+// tiers); ctz on the mask walks candidates in probe order.
+static uint64_t group_match(uint64_t group, uint8_t tag) {
+    uint64_t x = group ^ (0x0101010101010101ULL * tag);
+    return (x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL;
+}
 
-        if (state == MAP_EMPTY) {
-            return (first_tombstone >= 0) ? first_tombstone : slot;
+// Probe by aligned groups of 8 control bytes. On return, *found says
+// whether the slot holds the key; otherwise the slot is the insertion
+// candidate (first tombstone seen, else first empty), or -1 if the
+// table is full of tombstones. Tables are passed explicitly so the
+// same probe serves both sides of an incremental rehash.
+static int64_t map_probe(const RaskMap *m, const uint8_t *states, const char *keys,
+                         int64_t cap, const void *key, uint64_t h, int *found) {
+    int64_t groups = cap / MAP_GROUP;
+    int64_t g = (int64_t)(h % (uint64_t)groups);
+    int64_t first_free = -1;
+
+    for (int64_t probe = 0; probe < groups; probe++) {
+        int64_t base = ((g + probe) % groups) * MAP_GROUP;
+        uint64_t ctrl;
+        memcpy(&ctrl, states + base, 8);
+
+        uint64_t match = group_match(ctrl, map_tag(h));
+        while (match) {
+            int64_t slot = base + (__builtin_ctzll(match) >> 3);
+            if (m->eq_fn(keys + slot * m->key_size, key, m->key_size)) {
+                *found = 1;
+                return slot;
+            }
+            match &= match - 1;
         }
-        if (state == MAP_TOMBSTONE) {
-            if (first_tombstone < 0) first_tombstone = slot;
-            continue;
+
+        uint64_t not_full = ctrl & 0x8080808080808080ULL;
+        if (first_free < 0 && not_full) {
+            first_free = base + (__builtin_ctzll(not_full) >> 3);
         }
-        // MAP_OCCUPIED — compare key
-        if (m->eq_fn(m->keys + slot * m->key_size, key, m->key_size)) {
-            return slot;
+        // An empty slot ends the probe chain — the key can't be further on.
+        if (group_match(ctrl, MAP_EMPTY)) {
+            *found = 0;
+            return first_free;
         }
     }
-    // Table is full (shouldn't happen with load factor < 1)
-    return (first_tombstone >= 0) ? first_tombstone : -1;
+    *found = 0;
+    return first_free;
 }
 
-static void map_rehash(RaskMap *m) {
-    int64_t old_cap = m->cap;
-    uint8_t *old_states = m->states;
-    char *old_keys = m->keys;
-    char *old_vals = m->vals;
+static void map_drop_old(RaskMap *m) {
+    if (!m->old_states) return;
+    rask_realloc(m->old_states, m->old_cap, 0);
+    rask_realloc(m->old_keys, rask_safe_mul(m->old_cap, m->key_size), 0);
+    rask_realloc(m->old_vals, rask_safe_mul(m->old_cap, m->val_size), 0);
+    m->old_states = NULL;
+    m->old_keys = NULL;
+    m->old_vals = NULL;
+    m->old_cap = 0;
+    m->migrate_pos = 0;
+}
 
-    map_alloc_tables(m, old_cap * 2);
-    m->len = 0;
+// Swap in fresh tables of new_cap; the current tables stay live as the
+// migration source. Old tombstones die with the old table.
+static void map_begin_rehash(RaskMap *m, int64_t new_cap) {
+    m->old_cap = m->cap;
+    m->old_states = m->states;
+    m->old_keys = m->keys;
+    m->old_vals = m->vals;
+    m->migrate_pos = 0;
+    map_alloc_tables(m, new_cap);
     m->tombstones = 0;
+}
 
-    for (int64_t i = 0; i < old_cap; i++) {
-        if (old_states[i] == MAP_OCCUPIED) {
-            rask_map_insert(m, old_keys + i * m->key_size,
-                            old_vals + i * m->val_size);
-        }
+// Move up to `slots` old-table slots into the new tables. Migrated
+// slots become tombstones in the old table so its probe chains survive.
+static void map_migrate(RaskMap *m, int64_t slots) {
+    if (!m->old_states) return;
+    int64_t end = m->migrate_pos + slots;
+    if (end > m->old_cap) end = m->old_cap;
+
+    for (int64_t i = m->migrate_pos; i < end; i++) {
+        if (!MAP_IS_FULL(m->old_states[i])) continue;
+        const void *k = m->old_keys + i * m->key_size;
+        uint64_t h = m->hash_fn(k, m->key_size);
+        int found;
+        int64_t slot = map_probe(m, m->states, m->keys, m->cap, k, h, &found);
+        uint8_t prev = m->states[slot];
+        memcpy(m->keys + slot * m->key_size, k, (size_t)m->key_size);
+        memcpy(m->vals + slot * m->val_size,
+               m->old_vals + i * m->val_size, (size_t)m->val_size);
+        m->states[slot] = map_tag(h);
+        if (prev == MAP_TOMBSTONE) m->tombstones--;
+        m->old_states[i] = MAP_TOMBSTONE;
     }
 
-    rask_realloc(old_states, old_cap, 0);
-    rask_realloc(old_keys, rask_safe_mul(old_cap, m->key_size), 0);
-    rask_realloc(old_vals, rask_safe_mul(old_cap, m->val_size), 0);
+    m->migrate_pos = end;
+    if (m->migrate_pos >= m->old_cap) map_drop_old(m);
 }
 
 // ─── Public API ─────────────────────────────────────────────
@@ -145,6 +284,11 @@ RaskMap *rask_map_new_custom(int64_t key_size, int64_t val_size,
     m->val_size = val_size;
     m->len = 0;
     m->tombstones = 0;
+    m->old_cap = 0;
+    m->migrate_pos = 0;
+    m->old_states = NULL;
+    m->old_keys = NULL;
+    m->old_vals = NULL;
     m->hash_fn = hash;
     m->eq_fn = eq;
     map_alloc_tables(m, MAP_INITIAL_CAP);
@@ -153,6 +297,7 @@ RaskMap *rask_map_new_custom(int64_t key_size, int64_t val_size,
 
 void rask_map_free(RaskMap *m) {
     if (!m) return;
+    map_drop_old(m);
     if (m->states) rask_realloc(m->states, m->cap, 0);
     if (m->keys) rask_realloc(m->keys, rask_safe_mul(m->cap, m->key_size), 0);
     if (m->vals) rask_realloc(m->vals, rask_safe_mul(m->cap, m->val_size), 0);
@@ -166,44 +311,56 @@ int64_t rask_map_len(const RaskMap *m) {
 // Returns 0 if inserted new, 1 if updated existing.
 int64_t rask_map_insert(RaskMap *m, const void *key, const void *val) {
     if (!m) return -1;
+    map_migrate(m, MAP_MIGRATE_SLOTS);
 
-    // Rehash if occupied + tombstones exceed load threshold.
-    // Tombstones degrade probe chains just like occupied slots.
-    if ((m->len + m->tombstones + 1) * MAP_LOAD_MAX_DEN > m->cap * MAP_LOAD_MAX_NUM) {
-        map_rehash(m);
+    uint64_t h = m->hash_fn(key, m->key_size);
+    int found;
+
+    // Resolve update-vs-insert before any growth decision — growing
+    // shifts the current table to the old side and would hide the key.
+    int64_t slot = map_probe(m, m->states, m->keys, m->cap, key, h, &found);
+    if (found) {
+        memcpy(m->vals + slot * m->val_size, val, (size_t)m->val_size);
+        return 1;
+    }
+    if (m->old_states) {
+        int64_t old_slot = map_probe(m, m->old_states, m->old_keys, m->old_cap,
+                                     key, h, &found);
+        if (found) {
+            memcpy(m->old_vals + old_slot * m->val_size, val, (size_t)m->val_size);
+            return 1;
+        }
     }
 
-    int64_t slot = map_find_slot(m, key);
-    if (slot < 0) {
-        // Shouldn't happen after rehash
-        map_rehash(m);
-        slot = map_find_slot(m, key);
+    // New key. Grow if occupied + tombstones exceed the load threshold.
+    // Tombstones degrade probe chains just like occupied slots; len is
+    // conservative during rehash (counts entries still awaiting migration).
+    if (slot < 0 ||
+        (m->len + m->tombstones + 1) * MAP_LOAD_MAX_DEN > m->cap * MAP_LOAD_MAX_NUM) {
+        map_migrate(m, m->old_cap);  // finish any in-flight rehash first
+        map_begin_rehash(m, m->cap * 2);
+        slot = map_probe(m, m->states, m->keys, m->cap, key, h, &found);
     }
 
     uint8_t prev_state = m->states[slot];
     memcpy(m->keys + slot * m->key_size, key, (size_t)m->key_size);
     memcpy(m->vals + slot * m->val_size, val, (size_t)m->val_size);
-    m->states[slot] = MAP_OCCUPIED;
+    m->states[slot] = map_tag(h);
     if (prev_state == MAP_TOMBSTONE) m->tombstones--;
-    if (prev_state != MAP_OCCUPIED) m->len++;
-    return (prev_state == MAP_OCCUPIED) ? 1 : 0;
+    m->len++;
+    return 0;
 }
 
 void *rask_map_get(const RaskMap *m, const void *key) {
     if (!m || m->len == 0) return NULL;
 
     uint64_t h = m->hash_fn(key, m->key_size);
-    int64_t idx = (int64_t)(h % (uint64_t)m->cap);
-
-    for (int64_t i = 0; i < m->cap; i++) {
-        int64_t slot = (idx + i) % m->cap;
-        uint8_t state = m->states[slot];
-
-        if (state == MAP_EMPTY) return NULL;
-        if (state == MAP_TOMBSTONE) continue;
-        if (m->eq_fn(m->keys + slot * m->key_size, key, m->key_size)) {
-            return m->vals + slot * m->val_size;
-        }
+    int found;
+    int64_t slot = map_probe(m, m->states, m->keys, m->cap, key, h, &found);
+    if (found) return m->vals + slot * m->val_size;
+    if (m->old_states) {
+        slot = map_probe(m, m->old_states, m->old_keys, m->old_cap, key, h, &found);
+        if (found) return m->old_vals + slot * m->val_size;
     }
     return NULL;
 }
@@ -218,20 +375,23 @@ void *rask_map_get_unwrap(const RaskMap *m, const void *key) {
 
 int64_t rask_map_remove(RaskMap *m, const void *key) {
     if (!m || m->len == 0) return -1;
+    map_migrate(m, MAP_MIGRATE_SLOTS);
 
     uint64_t h = m->hash_fn(key, m->key_size);
-    int64_t idx = (int64_t)(h % (uint64_t)m->cap);
-
-    for (int64_t i = 0; i < m->cap; i++) {
-        int64_t slot = (idx + i) % m->cap;
-        uint8_t state = m->states[slot];
-
-        if (state == MAP_EMPTY) return -1;
-        if (state == MAP_TOMBSTONE) continue;
-        if (m->eq_fn(m->keys + slot * m->key_size, key, m->key_size)) {
-            m->states[slot] = MAP_TOMBSTONE;
+    int found;
+    int64_t slot = map_probe(m, m->states, m->keys, m->cap, key, h, &found);
+    if (found) {
+        m->states[slot] = MAP_TOMBSTONE;
+        m->len--;
+        m->tombstones++;
+        return 0;
+    }
+    if (m->old_states) {
+        slot = map_probe(m, m->old_states, m->old_keys, m->old_cap, key, h, &found);
+        if (found) {
+            // Old-table tombstones aren't counted — the table is dying anyway
+            m->old_states[slot] = MAP_TOMBSTONE;
             m->len--;
-            m->tombstones++;
             return 0;
         }
     }
@@ -248,19 +408,52 @@ int64_t rask_map_is_empty(const RaskMap *m) {
 
 void rask_map_clear(RaskMap *m) {
     if (!m) return;
+    map_drop_old(m);
     memset(m->states, MAP_EMPTY, (size_t)m->cap);
     m->len = 0;
     m->tombstones = 0;
 }
 
+// Pre-size for len + additional entries. Mirrors rask_vec_reserve:
+// a single up-front grow instead of repeated doubling during inserts.
+int64_t rask_map_reserve(RaskMap *m, int64_t additional) {
+    if (!m) return -1;
+    if (additional <= 0) return 0;
+
+    int64_t need = m->len + additional;
+    int64_t cap = MAP_INITIAL_CAP;
+    while (need * MAP_LOAD_MAX_DEN > cap * MAP_LOAD_MAX_NUM) cap *= 2;
+    if (cap <= m->cap) return 0;
+
+    if (m->len == 0) {
+        // Empty map: swap the tables directly, nothing to migrate
+        map_drop_old(m);
+        rask_realloc(m->states, m->cap, 0);
+        rask_realloc(m->keys, rask_safe_mul(m->cap, m->key_size), 0);
+        rask_realloc(m->vals, rask_safe_mul(m->cap, m->val_size), 0);
+        map_alloc_tables(m, cap);
+        m->tombstones = 0;
+        return 0;
+    }
+
+    map_migrate(m, m->old_cap);  // finish any in-flight rehash first
+    map_begin_rehash(m, cap);
+    return 0;
+}
+
 RaskVec *rask_map_keys(const RaskMap *m) {
     RaskVec *v = rask_vec_new(m ? m->key_size : 8);
     if (!m) return v;
     for (int64_t i = 0; i < m->cap; i++) {
-        if (m->states[i] == MAP_OCCUPIED) {
+        if (MAP_IS_FULL(m->states[i])) {
             rask_vec_push(v, m->keys + i * m->key_size);
         }
     }
+    for (int64_t i = 0; m->old_states && i < m->old_cap; i++) {
+        if (MAP_IS_FULL(m->old_states[i])) {
+            rask_vec_push(v, m->old_keys + i * m->key_size);
+        }
+    }
     return v;
 }
 
@@ -268,10 +461,15 @@ RaskVec *rask_map_values(const RaskMap *m) {
     RaskVec *v = rask_vec_new(m ? m->val_size : 8);
     if (!m) return v;
     for (int64_t i = 0; i < m->cap; i++) {
-        if (m->states[i] == MAP_OCCUPIED) {
+        if (MAP_IS_FULL(m->states[i])) {
             rask_vec_push(v, m->vals + i * m->val_size);
         }
     }
+    for (int64_t i = 0; m->old_states && i < m->old_cap; i++) {
+        if (MAP_IS_FULL(m->old_states[i])) {
+            rask_vec_push(v, m->old_vals + i * m->val_size);
+        }
+    }
     return v;
 }
 
@@ -281,23 +479,37 @@ RaskVec *rask_map_entries(const RaskMap *m) {
     RaskVec *v = rask_vec_new(16); // 16 bytes per (key, value) pair
     if (!m) return v;
     for (int64_t i = 0; i < m->cap; i++) {
-        if (m->states[i] == MAP_OCCUPIED) {
+        if (MAP_IS_FULL(m->states[i])) {
             struct { int64_t key; int64_t val; } pair;
             memcpy(&pair.key, m->keys + i * m->key_size, m->key_size < 8 ? m->key_size : 8);
             memcpy(&pair.val, m->vals + i * m->val_size, m->val_size < 8 ? m->val_size : 8);
             rask_vec_push(v, &pair);
         }
     }
+    for (int64_t i = 0; m->old_states && i < m->old_cap; i++) {
+        if (MAP_IS_FULL(m->old_states[i])) {
+            struct { int64_t key; int64_t val; } pair;
+            memcpy(&pair.key, m->old_keys + i * m->key_size, m->key_size < 8 ? m->key_size : 8);
+            memcpy(&pair.val, m->old_vals + i * m->val_size, m->val_size < 8 ? m->val_size : 8);
+            rask_vec_push(v, &pair);
+        }
+    }
     return v;
 }
 
 RaskMap *rask_map_clone(const RaskMap *m) {
     if (!m) return rask_map_new(8, 8);
     RaskMap *dst = rask_map_new_custom(m->key_size, m->val_size, m->hash_fn, m->eq_fn);
+    rask_map_reserve(dst, m->len);
     for (int64_t i = 0; i < m->cap; i++) {
-        if (m->states[i] == MAP_OCCUPIED) {
+        if (MAP_IS_FULL(m->states[i])) {
             rask_map_insert(dst, m->keys + i * m->key_size, m->vals + i * m->val_size);
         }
     }
+    for (int64_t i = 0; m->old_states && i < m->old_cap; i++) {
+        if (MAP_IS_FULL(m->old_states[i])) {
+            rask_map_insert(dst, m->old_keys + i * m->key_size, m->old_vals + i * m->val_size);
+        }
+    }
     return dst;
 }
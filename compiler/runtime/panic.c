@@ -23,6 +23,14 @@
 #define RASK_HAS_BACKTRACE 0
 #endif
 
+// ─── Runtime checks ────────────────────────────────────────
+
+// When RASK_RUNTIME_CHECKS=1 is set, null-pointer and validity checks
+// are active in the C runtime. Debug builds (RASK_DEBUG) always check.
+// Lives here, not runtime.c, so binaries that link runtime pieces
+// without the main entry point (C benchmark baselines) still resolve it.
+int rask_runtime_checks_enabled = 0;
+
 // ─── Per-thread panic context ──────────────────────────────
 
 struct RaskPanicCtx {
@@ -64,6 +72,20 @@ char *rask_panic_take_message(void) {
     return msg;
 }
 
+// Copy the thread's panic context out/in. green.c parks a fiber's context
+// across suspensions — the jmp_buf targets the fiber's own stack, so the
+// copy stays valid on whichever worker thread resumes the fiber.
+_Static_assert(sizeof(struct RaskPanicCtx) <= RASK_PANIC_CTX_MAX,
+               "RaskPanicCtx grew past RASK_PANIC_CTX_MAX");
+
+void rask_panic_ctx_export(void *out) {
+    memcpy(out, &panic_ctx, sizeof(panic_ctx));
+}
+
+void rask_panic_ctx_import(const void *in) {
+    memcpy(&panic_ctx, in, sizeof(panic_ctx));
+}
+
 // ─── Ensure hooks (LIFO cleanup stack) ─────────────────────
 //
 // Per-thread linked list of scheduled cleanups. Codegen pushes one per
@@ -181,6 +203,14 @@ void rask_set_panic_location(const char *file, int32_t line, int32_t col) {
     panic_loc_col  = col;
 }
 
+// Read the last location codegen set on this thread without consuming it.
+// The allocation profiler uses this for call-site attribution.
+const char *rask_panic_location_file(int32_t *line, int32_t *col) {
+    *line = panic_loc_line;
+    *col  = panic_loc_col;
+    return panic_loc_file;
+}
+
 // ─── Panic entry points ────────────────────────────────────
 
 _Noreturn void rask_panic(const char *msg) {
@@ -5,14 +5,18 @@
 // Free slots form a singly-linked list through an index field.
 //
 // Layout: interleaved [gen:u32][next_free:i32][data:elem_size] per slot.
-// Single allocation, one cache line per access.
+// Slots live in fixed-size chunks (POOL_CHUNK_SLOTS each) reached through
+// a pointer table: chunk = index >> POOL_CHUNK_SHIFT, slot within chunk =
+// index & POOL_CHUNK_MASK. Growth allocates one chunk and never moves
+// existing elements, so a slot's address is stable for the pool's
+// lifetime — `with`-scoped accesses stay valid across inserts.
 // next_free == -2 means "occupied" (sentinel).
 
 #include "rask_runtime.h"
 #include <stdlib.h>
 #include <string.h>
 
-// Slot offsets within the interleaved array
+// Slot offsets within the interleaved chunk
 #define SLOT_GEN_OFFSET    0
 #define SLOT_NEXT_OFFSET   4
 #define SLOT_DATA_OFFSET   8
@@ -20,15 +24,24 @@
 // Occupied sentinel — distinct from valid free-list values (>= 0 or -1)
 #define SLOT_OCCUPIED      (-2)
 
+// 256 slots per chunk — a page of 8-byte elements. The shift is a
+// constant so release-mode codegen can inline the chunk walk
+// (layouts.rs POOL_CHUNK_SHIFT must match).
+#define POOL_CHUNK_SHIFT   8
+#define POOL_CHUNK_SLOTS   (1 << POOL_CHUNK_SHIFT)
+#define POOL_CHUNK_MASK    (POOL_CHUNK_SLOTS - 1)
+
 struct RaskPool {
     uint32_t  pool_id;       // offset 0
     uint32_t  _pad;          // offset 4 (alignment)
     int64_t   elem_size;     // offset 8
     int64_t   slot_stride;   // offset 16
-    int64_t   cap;           // offset 24
+    int64_t   cap;           // offset 24 (always a whole number of chunks)
     int64_t   len;           // offset 32
-    char     *slots;         // offset 40
+    char    **chunks;        // offset 40 (chunk pointer table)
     int32_t   free_head;     // offset 48
+    int32_t   chunk_cap;     // offset 52 (entries allocated in chunks table)
+    uint64_t *occ;           // occupancy bitmap, cap/64 words
 };
 
 // Compile-time layout verification — codegen hardcodes these offsets
@@ -37,7 +50,7 @@ _Static_assert(offsetof(struct RaskPool, elem_size) == 8, "elem_size offset");
 _Static_assert(offsetof(struct RaskPool, slot_stride) == 16, "slot_stride offset");
 _Static_assert(offsetof(struct RaskPool, cap) == 24, "cap offset");
 _Static_assert(offsetof(struct RaskPool, len) == 32, "len offset");
-_Static_assert(offsetof(struct RaskPool, slots) == 40, "slots offset");
+_Static_assert(offsetof(struct RaskPool, chunks) == 40, "chunks offset");
 _Static_assert(offsetof(struct RaskPool, free_head) == 48, "free_head offset");
 
 static uint32_t g_next_pool_id = 1;
@@ -47,9 +60,10 @@ static inline int64_t compute_stride(int64_t elem_size) {
     return ((8 + elem_size + 7) / 8) * 8;
 }
 
-// Slot accessors — slot base address is p->slots + idx * p->slot_stride
+// Slot accessors — chunk walk, then offset within the chunk
 static inline char *slot_at(const RaskPool *p, int64_t idx) {
-    return p->slots + idx * p->slot_stride;
+    return p->chunks[idx >> POOL_CHUNK_SHIFT]
+         + (idx & POOL_CHUNK_MASK) * p->slot_stride;
 }
 
 static inline uint32_t slot_gen(const char *slot) {
@@ -76,12 +90,51 @@ static inline void *slot_data(const char *slot) {
     return (void *)(slot + SLOT_DATA_OFFSET);
 }
 
-static void pool_grow(RaskPool *p, int64_t new_cap) {
-    int64_t old_bytes = rask_safe_mul(p->cap, p->slot_stride);
-    int64_t new_bytes = rask_safe_mul(new_cap, p->slot_stride);
-    p->slots = (char *)rask_realloc(p->slots, old_bytes, new_bytes);
+// Occupancy bitmap — one bit per slot, kept in sync by insert/remove.
+// Lets iteration skip whole free words instead of probing every slot
+// header (64 slots per load for sparse pools).
+static inline void occ_set(RaskPool *p, int64_t idx) {
+    p->occ[idx >> 6] |= (uint64_t)1 << (idx & 63);
+}
+
+static inline void occ_clear(RaskPool *p, int64_t idx) {
+    p->occ[idx >> 6] &= ~((uint64_t)1 << (idx & 63));
+}
+
+// Grow to at least min_cap slots, rounded up to whole chunks. Only the
+// pointer table reallocates — existing chunks (and every live element in
+// them) stay where they are.
+static void pool_grow(RaskPool *p, int64_t min_cap) {
+    int64_t old_chunks = p->cap >> POOL_CHUNK_SHIFT;
+    int64_t new_chunks = (min_cap + POOL_CHUNK_MASK) >> POOL_CHUNK_SHIFT;
+    if (new_chunks <= old_chunks) return;
+
+    if (new_chunks > p->chunk_cap) {
+        int64_t table_cap = p->chunk_cap ? p->chunk_cap : 8;
+        while (table_cap < new_chunks) table_cap *= 2;
+        p->chunks = (char **)rask_realloc(p->chunks,
+                                          p->chunk_cap * (int64_t)sizeof(char *),
+                                          table_cap * (int64_t)sizeof(char *));
+        p->chunk_cap = (int32_t)table_cap;
+    }
+
+    int64_t chunk_bytes = rask_safe_mul(POOL_CHUNK_SLOTS, p->slot_stride);
+    for (int64_t c = old_chunks; c < new_chunks; c++) {
+        p->chunks[c] = (char *)rask_alloc(chunk_bytes);
+    }
+
+    // Occupancy bitmap grows with capacity (cap is chunk-aligned, so
+    // word counts are exact: 4 words per chunk). New words start free.
+    int64_t old_words = old_chunks << (POOL_CHUNK_SHIFT - 6);
+    int64_t new_words = new_chunks << (POOL_CHUNK_SHIFT - 6);
+    p->occ = (uint64_t *)rask_realloc(p->occ,
+                                      old_words * (int64_t)sizeof(uint64_t),
+                                      new_words * (int64_t)sizeof(uint64_t));
+    memset(p->occ + old_words, 0,
+           (size_t)((new_words - old_words) * (int64_t)sizeof(uint64_t)));
 
     // Initialize new slots as free, chained together
+    int64_t new_cap = new_chunks << POOL_CHUNK_SHIFT;
     for (int64_t i = p->cap; i < new_cap; i++) {
         char *slot = slot_at(p, i);
         slot_set_gen(slot, 0);
@@ -101,8 +154,10 @@ RaskPool *rask_pool_new(int64_t elem_size) {
     p->slot_stride = compute_stride(elem_size);
     p->cap = 0;
     p->len = 0;
-    p->slots = NULL;
+    p->chunks = NULL;
     p->free_head = -1;
+    p->chunk_cap = 0;
+    p->occ = NULL;
     return p;
 }
 
@@ -114,9 +169,25 @@ RaskPool *rask_pool_with_capacity(int64_t elem_size, int64_t cap) {
     return p;
 }
 
+// Pre-size for an expected element count — one table growth, chunk_count
+// chunk allocations, no per-insert stalls afterwards.
+void rask_pool_reserve(RaskPool *p, int64_t cap) {
+    if (!p || cap <= p->cap) return;
+    pool_grow(p, cap);
+}
+
 void rask_pool_free(RaskPool *p) {
     if (!p) return;
-    if (p->slots) rask_realloc(p->slots, rask_safe_mul(p->cap, p->slot_stride), 0);
+    if (p->chunks) {
+        int64_t chunks = p->cap >> POOL_CHUNK_SHIFT;
+        for (int64_t c = 0; c < chunks; c++) {
+            rask_free(p->chunks[c]);
+        }
+        rask_realloc(p->chunks, p->chunk_cap * (int64_t)sizeof(char *), 0);
+    }
+    if (p->occ) {
+        rask_realloc(p->occ, (p->cap >> 6) * (int64_t)sizeof(uint64_t), 0);
+    }
     rask_realloc(p, (int64_t)sizeof(RaskPool), 0);
 }
 
@@ -134,10 +205,9 @@ RaskHandle rask_pool_insert(RaskPool *p, const void *elem) {
     if (!p) return h;
 #endif
 
-    // Grow if no free slots
+    // Grow by one chunk if no free slots — O(1), no element copies
     if (p->free_head < 0) {
-        int64_t new_cap = p->cap ? p->cap * 2 : 4;
-        pool_grow(p, new_cap);
+        pool_grow(p, p->cap + 1);
     }
 
     // Pop from free list
@@ -145,6 +215,7 @@ RaskHandle rask_pool_insert(RaskPool *p, const void *elem) {
     char *slot = slot_at(p, idx);
     p->free_head = slot_next(slot);
     slot_set_next(slot, SLOT_OCCUPIED);
+    occ_set(p, idx);
 
     // Write element data
     memcpy(slot_data(slot), elem, (size_t)p->elem_size);
@@ -190,6 +261,7 @@ int64_t rask_pool_remove(RaskPool *p, RaskHandle h, void *out) {
     // Push onto free list
     slot_set_next(slot, p->free_head);
     p->free_head = (int32_t)h.index;
+    occ_clear(p, h.index);
     p->len--;
     return 0;
 }
@@ -271,17 +343,48 @@ int64_t rask_pool_is_valid_packed(const RaskPool *p, int64_t packed) {
     return rask_pool_is_valid(p, handle_unpack(p, packed));
 }
 
+// ─── Dense iteration (occupancy bitmap) ────────────────────
+// Cursor walk over occupied slots in index order — no allocation, no
+// copies, direct element pointers. Typical loop:
+//   for (int64_t i = rask_pool_next_index(p, 0); i >= 0;
+//        i = rask_pool_next_index(p, i + 1)) {
+//       T *e = rask_pool_data_at(p, i);
+//   }
+// Removing the current element is fine (the bitmap bit is already
+// cleared when the cursor moves on); inserting during the walk may or
+// may not visit the new element, same as the snapshot rules (PF3).
+
+int64_t rask_pool_next_index(const RaskPool *p, int64_t from) {
+    if (!p || from < 0) return -1;
+    int64_t words = p->cap >> 6; // cap is chunk-aligned, exact
+    int64_t w = from >> 6;
+    if (w >= words) return -1;
+    uint64_t word = p->occ[w] & (~(uint64_t)0 << (from & 63));
+    for (;;) {
+        if (word) return (w << 6) + __builtin_ctzll(word);
+        if (++w >= words) return -1;
+        word = p->occ[w];
+    }
+}
+
+void *rask_pool_data_at(const RaskPool *p, int64_t idx) {
+    return slot_data(slot_at(p, idx));
+}
+
+int64_t rask_pool_handle_at(const RaskPool *p, int64_t idx) {
+    RaskHandle h;
+    h.pool_id = p->pool_id;
+    h.index = (uint32_t)idx;
+    h.generation = slot_gen(slot_at(p, idx));
+    return handle_pack(h);
+}
+
 RaskVec *rask_pool_handles_packed(const RaskPool *p) {
     RaskVec *v = rask_vec_new(8);
     if (!p) return v;
-    for (int64_t i = 0; i < p->cap; i++) {
-        char *slot = slot_at(p, i);
-        if (slot_next(slot) != SLOT_OCCUPIED) continue;
-        RaskHandle h;
-        h.pool_id = p->pool_id;
-        h.index = (uint32_t)i;
-        h.generation = slot_gen(slot);
-        int64_t packed = handle_pack(h);
+    for (int64_t i = rask_pool_next_index(p, 0); i >= 0;
+         i = rask_pool_next_index(p, i + 1)) {
+        int64_t packed = rask_pool_handle_at(p, i);
         rask_vec_push(v, &packed);
     }
     return v;
@@ -290,10 +393,9 @@ RaskVec *rask_pool_handles_packed(const RaskPool *p) {
 RaskVec *rask_pool_values(const RaskPool *p) {
     RaskVec *v = rask_vec_new(p ? p->elem_size : 8);
     if (!p) return v;
-    for (int64_t i = 0; i < p->cap; i++) {
-        char *slot = slot_at(p, i);
-        if (slot_next(slot) != SLOT_OCCUPIED) continue;
-        rask_vec_push(v, slot_data(slot));
+    for (int64_t i = rask_pool_next_index(p, 0); i >= 0;
+         i = rask_pool_next_index(p, i + 1)) {
+        rask_vec_push(v, rask_pool_data_at(p, i));
     }
     return v;
 }
@@ -301,9 +403,9 @@ RaskVec *rask_pool_values(const RaskPool *p) {
 RaskVec *rask_pool_drain(RaskPool *p) {
     RaskVec *v = rask_vec_new(p ? p->elem_size : 8);
     if (!p) return v;
-    for (int64_t i = 0; i < p->cap; i++) {
+    for (int64_t i = rask_pool_next_index(p, 0); i >= 0;
+         i = rask_pool_next_index(p, i + 1)) {
         char *slot = slot_at(p, i);
-        if (slot_next(slot) != SLOT_OCCUPIED) continue;
         rask_vec_push(v, slot_data(slot));
         // Free the slot
         uint32_t gen = slot_gen(slot);
@@ -312,6 +414,7 @@ RaskVec *rask_pool_drain(RaskPool *p) {
         }
         slot_set_next(slot, p->free_head);
         p->free_head = (int32_t)i;
+        occ_clear(p, i);
         p->len--;
     }
     return v;
@@ -324,10 +427,9 @@ RaskHandle rask_pool_alloc(RaskPool *p) {
     if (!p) return h;
 #endif
 
-    // Grow if no free slots
+    // Grow by one chunk if no free slots — O(1), no element copies
     if (p->free_head < 0) {
-        int64_t new_cap = p->cap ? p->cap * 2 : 4;
-        pool_grow(p, new_cap);
+        pool_grow(p, p->cap + 1);
     }
 
     // Pop from free list
@@ -335,6 +437,7 @@ RaskHandle rask_pool_alloc(RaskPool *p) {
     char *slot = slot_at(p, idx);
     p->free_head = slot_next(slot);
     slot_set_next(slot, SLOT_OCCUPIED);
+    occ_set(p, idx);
 
     // Zero-initialize element data
     memset(slot_data(slot), 0, (size_t)p->elem_size);
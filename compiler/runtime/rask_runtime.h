@@ -32,11 +32,39 @@ typedef struct {
 void  rask_allocator_set(const RaskAllocator *a);
 void  rask_alloc_stats(RaskAllocStats *out);
 
+// Allocation profiler — size-class histogram + call-site attribution via
+// the thread-local panic location. Enabled with RASK_ALLOC_PROFILE=1 at
+// startup; dump runs at exit (JSON on stderr).
+extern int rask_alloc_profile_enabled;
+void  rask_alloc_profile_dump(void);
+
+// Benchmark baseline check — nonzero when any benchmark regressed past
+// the threshold. The entry point returns this so the process fails via
+// a normal exit (atexit handlers, including the profiler dump, still run).
+int rask_bench_failed(void);
+
 // These use the active allocator (default: malloc/free).
 void *rask_alloc(int64_t size);
 void *rask_realloc(void *ptr, int64_t old_size, int64_t new_size);
 void  rask_free(void *ptr);
 
+// Arena backend — bump allocator with scoped reset.
+// Typical use: rask_arena_allocator() + rask_allocator_set() at startup,
+// then scope_begin/scope_end around each request. Frees inside a scope
+// are no-ops; scope_end rewinds in O(chunks allocated since begin).
+typedef struct RaskArena RaskArena;
+
+RaskArena *rask_arena_new(int64_t chunk_size);     // chunk_size <= 0 → 64 KiB default
+void       rask_arena_destroy(RaskArena *a);
+void       rask_arena_allocator(RaskArena *a, RaskAllocator *out);
+void       rask_arena_scope_begin(RaskArena *a);
+void       rask_arena_scope_end(RaskArena *a);
+
+// Thread-local slab backend — per-thread size-class free lists for hot
+// small allocations, malloc fallback above 256 bytes. Selected at startup
+// with RASK_ALLOC=slab (like RASK_RUNTIME_CHECKS).
+void       rask_slab_allocator(RaskAllocator *out);
+
 // Overflow-checked arithmetic for allocation sizes.
 _Noreturn void rask_panic(const char *msg);
 _Noreturn void rask_panic_fmt(const char *fmt, ...);
@@ -63,6 +91,21 @@ static inline int64_t rask_safe_add(int64_t a, int64_t b) {
     return a + b;
 }
 
+// ─── CPU feature detection (cpu.c) ─────────────────────────
+// Queried once at startup; kernels with ISA variants re-point their
+// function pointers in rask_simd_dispatch_init. RASK_CPU=scalar
+// forces the portable fallbacks.
+
+#define RASK_CPU_AVX2    (1 << 0)
+#define RASK_CPU_FMA     (1 << 1)
+#define RASK_CPU_AVX512F (1 << 2)
+#define RASK_CPU_NEON    (1 << 3)
+
+void    rask_cpu_init(void);
+int64_t rask_cpu_features(void);
+int     rask_cpu_has(int64_t feature);
+void    rask_simd_dispatch_init(void); // simd.c — called by rask_cpu_init
+
 // ─── Resource tracking ─────────────────────────────────────
 // Consumed-flag tracker for ensure consumption cancellation (C1/C2).
 int64_t rask_resource_register(int64_t scope_depth);
@@ -82,6 +125,8 @@ void     rask_vec_free(RaskVec *v);
 int64_t  rask_vec_len(const RaskVec *v);
 int64_t  rask_vec_capacity(const RaskVec *v);
 int64_t  rask_vec_push(RaskVec *v, const void *elem);
+int64_t  rask_vec_push_many(RaskVec *v, const void *elems, int64_t count);
+int64_t  rask_vec_extend(RaskVec *v, const RaskVec *src);
 void    *rask_vec_get(const RaskVec *v, int64_t index);
 void    *rask_vec_get_unchecked(const RaskVec *v, int64_t index);
 void    *rask_vec_get_opt(const RaskVec *v, int64_t index);
@@ -103,6 +148,17 @@ void     rask_vec_dedup(RaskVec *v);
 void    *rask_vec_first(const RaskVec *v);
 void    *rask_vec_last(const RaskVec *v);
 
+// Whole-Vec reduction kernels — walk the buffer directly, vectorizer-
+// friendly. min/max panic on empty; dot panics on length mismatch.
+double   rask_vec_sum_f64(const RaskVec *v);
+double   rask_vec_min_f64(const RaskVec *v);
+double   rask_vec_max_f64(const RaskVec *v);
+double   rask_vec_dot_f64(const RaskVec *a, const RaskVec *b);
+int64_t  rask_vec_sum_i64(const RaskVec *v);
+int64_t  rask_vec_min_i64(const RaskVec *v);
+int64_t  rask_vec_max_i64(const RaskVec *v);
+int64_t  rask_vec_dot_i64(const RaskVec *a, const RaskVec *b);
+
 // ─── String ─────────────────────────────────────────────────
 // 16-byte tagged union with small string optimization (SSO).
 //
@@ -112,7 +168,7 @@ void    *rask_vec_last(const RaskVec *v);
 //
 // Heap mode (MSB of byte 15 = 1):
 //   [header_ptr: *u8 (8B)][tagged_len: u64 (8B)]
-//   tagged_len = len | (1<<63). Header: { refcount_u32, cap_u32, data[] }
+//   tagged_len = len | (1<<63). Header: { refcount_u32, cap_u32, hash_u64, data[] }
 //
 // RC only applies to heap mode. Sentinel refcount (UINT32_MAX) = static literal.
 
@@ -126,6 +182,10 @@ typedef union {
 void        rask_string_new(RaskStr *out);
 void        rask_string_from(RaskStr *out, const char *s);
 void        rask_string_from_bytes(RaskStr *out, const char *data, int64_t len);
+void        rask_string_adopt_mapping(RaskStr *out, uint8_t *base, uint64_t total, int64_t len);
+char       *rask_string_alloc_buffer(RaskStr *out, int64_t cap);  // uninitialized payload
+void        rask_string_set_len(RaskStr *s, int64_t len);
+int64_t     rask_string_is_unique(const RaskStr *s);
 
 // RC operations — codegen calls after inline tag check (RC5)
 void        rask_string_free(const RaskStr *s);
@@ -133,7 +193,9 @@ void        rask_string_clone(const RaskStr *s);
 
 // Read-only accessors
 int64_t     rask_string_len(const RaskStr *s);
-const char *rask_string_ptr(const RaskStr *s);
+const char *rask_string_ptr(const RaskStr *s);    // NUL-terminated; may detach a slice
+const char *rask_string_bytes(const RaskStr *s);  // raw bytes, not NUL-terminated
+uint64_t   *rask_string_hash_slot(const RaskStr *s);
 int64_t     rask_string_is_empty(const RaskStr *s);
 int64_t     rask_string_eq(const RaskStr *a, const RaskStr *b);
 int64_t     rask_string_compare(const RaskStr *a, const RaskStr *b);
@@ -259,6 +321,7 @@ int64_t  rask_map_remove(RaskMap *m, const void *key);
 int64_t  rask_map_contains(const RaskMap *m, const void *key);
 int64_t  rask_map_is_empty(const RaskMap *m);
 void     rask_map_clear(RaskMap *m);
+int64_t  rask_map_reserve(RaskMap *m, int64_t additional);
 RaskVec *rask_map_keys(const RaskMap *m);
 RaskVec *rask_map_values(const RaskMap *m);
 RaskMap *rask_map_clone(const RaskMap *m);
@@ -280,6 +343,7 @@ typedef struct RaskPool RaskPool;
 
 RaskPool   *rask_pool_new(int64_t elem_size);
 RaskPool   *rask_pool_with_capacity(int64_t elem_size, int64_t cap);
+void        rask_pool_reserve(RaskPool *p, int64_t cap);
 void        rask_pool_free(RaskPool *p);
 int64_t     rask_pool_len(const RaskPool *p);
 int64_t     rask_pool_is_empty(const RaskPool *p);
@@ -302,6 +366,12 @@ RaskVec    *rask_pool_handles_packed(const RaskPool *p);
 RaskVec    *rask_pool_values(const RaskPool *p);
 RaskVec    *rask_pool_drain(RaskPool *p);
 
+// Zero-copy dense iteration — walk occupied slots in index order via the
+// occupancy bitmap, no snapshot Vec. next_index returns -1 when done.
+int64_t     rask_pool_next_index(const RaskPool *p, int64_t from);
+void       *rask_pool_data_at(const RaskPool *p, int64_t idx);
+int64_t     rask_pool_handle_at(const RaskPool *p, int64_t idx);
+
 #define RASK_HANDLE_INVALID ((RaskHandle){0, UINT32_MAX, 0})
 
 // Packed sentinel for Option<Handle<T>> niche optimization.
@@ -347,10 +417,16 @@ int64_t     rask_stat_size(const char *path);
 int64_t     rask_stat_mtime(const char *path);
 int64_t     rask_stat_atime(const char *path);
 void        rask_fs_read_file(RaskStr *out, const RaskStr *path);
+void        rask_fs_map_file(RaskStr *out, const RaskStr *path);
 RaskVec    *rask_fs_read_bytes(const RaskStr *path);
 void        rask_fs_write_file(const RaskStr *path, const RaskStr *content);
 void        rask_fs_write_bytes(const RaskStr *path, RaskVec *data);
 RaskVec    *rask_fs_read_lines(const RaskStr *path);
+
+// Streaming line reader — one syscall per chunk, slice views per line
+int64_t        rask_fs_lines(const RaskStr *path);
+const RaskStr *rask_line_reader_next(int64_t reader_ptr);  // NULL at EOF
+void           rask_line_reader_free(int64_t reader_ptr);
 RaskVec    *rask_fs_list_dir(const RaskStr *path);
 int64_t     rask_fs_open(const RaskStr *path);
 int64_t     rask_fs_create(const RaskStr *path);
@@ -381,6 +457,12 @@ int64_t     rask_io_write_string(int64_t fd, int64_t str_ptr);
 
 int64_t rask_time_Instant_now(void);
 int64_t rask_time_Instant_elapsed(int64_t instant_ns);
+
+// Fast clock — invariant-TSC timestamps on the CLOCK_MONOTONIC epoch,
+// falling back to clock_gettime where the TSC is unreliable. init
+// calibrates once (rask_runtime_init calls it; first use also works).
+void    rask_time_fast_clock_init(void);
+int64_t rask_time_Instant_now_fast(void);
 int64_t rask_time_Duration_from_nanos(int64_t ns);
 int64_t rask_time_Duration_from_millis(int64_t ms);
 int64_t rask_time_Duration_as_nanos(int64_t duration_ns);
@@ -407,6 +489,8 @@ void    rask_http_server_close(int64_t server_ptr);
 int64_t rask_net_clone(int64_t fd);
 int64_t rask_net_read_all(int64_t fd, int64_t out_ptr);
 int64_t rask_net_write_all(int64_t fd, int64_t str_ptr);
+int64_t rask_net_write_many(int64_t fd, RaskVec *segments);  // vectored
+void    rask_net_set_cork(int64_t fd, int64_t on);
 void    rask_net_remote_addr(RaskStr *out, int64_t fd);
 
 // ─── Filesystem metadata ────────────────────────────────────
@@ -439,6 +523,7 @@ void         rask_json_buf_add_f64(RaskJsonBuf *buf, const RaskStr *key, double
 void         rask_json_buf_add_bool(RaskJsonBuf *buf, const RaskStr *key, int64_t val);
 void         rask_json_buf_add_raw(RaskJsonBuf *buf, const RaskStr *key, const RaskStr *raw_json);
 void         rask_json_buf_finish(RaskStr *out, RaskJsonBuf *buf);
+void         rask_json_buf_reset(RaskJsonBuf *buf);  // truncate for reuse across encodes
 
 void         rask_json_encode(RaskStr *out, int64_t value_ptr);
 void         rask_json_encode_string(RaskStr *out, const RaskStr *s);
@@ -507,6 +592,12 @@ typedef struct RaskPanicCtx RaskPanicCtx;
 RaskPanicCtx *rask_panic_install(void);
 void          rask_panic_remove(void);
 
+// Upper bound on sizeof(struct RaskPanicCtx) — green.c parks fiber panic
+// contexts in buffers of this size (checked by a static assert in panic.c).
+#define RASK_PANIC_CTX_MAX 512
+void rask_panic_ctx_export(void *out);
+void rask_panic_ctx_import(const void *in);
+
 // ─── Green scheduler (M:N) ──────────────────────────────────
 // Work-stealing scheduler with io_uring/epoll I/O engine.
 // Tasks are stackless state machines: poll_fn(state, ctx) → 0=READY, 1=PENDING.
@@ -514,6 +605,11 @@ void          rask_panic_remove(void);
 void      rask_runtime_init(int64_t worker_count);
 void      rask_runtime_shutdown(void);
 
+// Shrink/restore the active worker set at runtime (clamped to the init
+// count — threads are created once). Dormant workers keep their timer
+// wheels ticking but take no new work.
+void      rask_runtime_resize(int64_t worker_count);
+
 // Spawn a green task. poll_fn signature: int (*)(void *state, void *task_ctx).
 // state is heap-allocated, freed by scheduler on completion.
 void     *rask_green_spawn(void *poll_fn, void *state, int64_t state_size);
@@ -524,18 +620,54 @@ int64_t   rask_green_cancel(void *handle);
 // Closure-based spawn (bridge for codegen before state machine transform).
 void     *rask_green_closure_spawn(void *closure_ptr);
 
+// Stackful fiber spawn (Phase B): fn(arg) runs on its own mmap'd stack and
+// may suspend from anywhere in its call graph via rask_yield* or
+// rask_fiber_blocking. Same handle semantics as rask_green_spawn.
+void     *rask_green_spawn_fiber(void (*fn)(void *), void *arg);
+
+// Run a blocking C call (DB client, DNS, fsync) on the blocking pool while
+// the calling fiber is parked; the worker moves on. Returns fn's result.
+// Outside a fiber this calls fn directly.
+int64_t   rask_fiber_blocking(int64_t (*fn)(void *), void *arg);
+
 // Yield helpers — called by state machines to pause on I/O.
+struct iovec;
 void      rask_yield_read(int fd, void *buf, size_t len);
 void      rask_yield_write(int fd, const void *buf, size_t len);
+void      rask_yield_writev(int fd, const struct iovec *iov, int iovcnt);
 void      rask_yield_accept(int listen_fd);
 void      rask_yield_timeout(uint64_t ns);
 
+// Drop I/O engine state tied to fd (fixed-file slots) before closing it.
+void      rask_io_forget_fd(int fd);
+
 // Cooperative yield — re-enqueue current task for later polling.
 void      rask_yield(void);
 
 // Check cancel flag for the current green task.
 int       rask_green_task_is_cancelled(void);
 
+// Scheduler counters, aggregated across workers. Maintained with relaxed
+// atomics — cheap to keep, approximate under concurrency. Set
+// RASK_SCHED_STATS=<seconds> for a periodic stderr dump.
+typedef struct {
+    int64_t workers;
+    int64_t active_tasks;
+    int64_t tasks_executed;
+    int64_t steals_attempted;
+    int64_t steals_succeeded;
+    int64_t parks;
+    int64_t io_completions;
+    int64_t io_poll_ns;       // time inside engine poll (dump mode only)
+    int64_t io_polls;
+    int64_t timers_fired;
+    int64_t max_deque_depth;  // max over workers since start
+    int64_t deque_overflows;  // local deque full → task spilled to global
+    int64_t global_overflows; // global queue full → task dropped
+} RaskSchedStats;
+
+void      rask_sched_stats(RaskSchedStats *out);
+
 // ─── Threads ───────────────────────────────────────────────
 // Phase A concurrency: one OS thread per spawn (conc.strategy/A1).
 // TaskHandle is affine — must be joined, detached, or cancelled.
@@ -582,6 +714,10 @@ typedef struct RaskSender  RaskSender;
 typedef struct RaskRecver  RaskRecver;
 
 // Status codes for channel operations.
+// Buffered elements above this size switch the channel to pointer-transfer
+// mode: the ring carries an owning pointer instead of inline bytes.
+#define RASK_CHAN_INDIRECT_THRESHOLD 256
+
 #define RASK_CHAN_OK     0
 #define RASK_CHAN_CLOSED -1
 #define RASK_CHAN_FULL   -2
@@ -604,6 +740,25 @@ int64_t rask_channel_recv(RaskRecver *rx, void *data_out);
 int64_t rask_channel_try_send(RaskSender *tx, const void *data);
 int64_t rask_channel_try_recv(RaskRecver *rx, void *data_out);
 
+// Batched variants: move up to count/max contiguous elements in one
+// synchronization episode. Return elements moved, or RASK_CHAN_CLOSED.
+// Blocking forms wait until at least one element moves; try forms return 0
+// when nothing fits. data/out point to an array of elem_size elements.
+int64_t rask_channel_send_many(RaskSender *tx, const void *data, int64_t count);
+int64_t rask_channel_recv_many(RaskRecver *rx, void *out, int64_t max);
+int64_t rask_channel_try_send_many(RaskSender *tx, const void *data, int64_t count);
+int64_t rask_channel_try_recv_many(RaskRecver *rx, void *out, int64_t max);
+
+// Zero-copy transfer on pointer-transfer channels (elem_size above
+// RASK_CHAN_INDIRECT_THRESHOLD): send gives up an owning heap block, recv
+// adopts one. Panics if the channel is not in pointer-transfer mode. On
+// CLOSED the sender keeps ownership.
+int64_t rask_channel_send_owned(RaskSender *tx, void *block);
+int64_t rask_channel_recv_owned(RaskRecver *rx, void **block_out);
+
+// Cleanup for values stranded in a dropped channel (default: rask_free).
+void rask_channel_set_drop(RaskSender *tx, void (*drop_fn)(void *));
+
 // Clone a sender (increment refcount). Multiple producers supported.
 RaskSender *rask_sender_clone(RaskSender *tx);
 
@@ -632,6 +787,7 @@ int64_t rask_recver_close_i64(int64_t rx);
 
 int64_t rask_async_read(int fd, void *buf, int64_t len);
 int64_t rask_async_write(int fd, const void *buf, int64_t len);
+int64_t rask_async_writev(int fd, const struct iovec *iov, int iovcnt);
 int64_t rask_async_accept(int listen_fd);
 
 // ─── Async channels (yield-based) ──────────────────────────
@@ -640,6 +796,10 @@ int64_t rask_async_accept(int listen_fd);
 
 int64_t rask_channel_send_async(int64_t tx, int64_t value);
 int64_t rask_channel_recv_async(int64_t rx);
+int64_t rask_channel_send_many_async(int64_t tx, int64_t data_ptr, int64_t count);
+int64_t rask_channel_recv_many_async(int64_t rx, int64_t out_ptr, int64_t max);
+int64_t rask_channel_send_owned_i64(int64_t tx, int64_t block);
+int64_t rask_channel_recv_owned_i64(int64_t rx);
 
 // ─── Green-aware sleep ──────────────────────────────────────
 // Yields to scheduler in green tasks, blocking nanosleep otherwise.
@@ -686,9 +846,10 @@ int64_t rask_mutex_try_lock_ptr(int64_t mutex, int64_t closure);
 int64_t rask_mutex_clone(int64_t mutex);
 void    rask_mutex_drop(int64_t mutex);
 
-// ─── Shared (RwLock) ───────────────────────────────────────
+// ─── Shared (read-mostly lock) ─────────────────────────────
 // Multiple-reader / exclusive-writer wrapper (conc.sync/SY1, R1-R3).
-// Wraps pthread_rwlock.
+// Distributed reader counts: uncontended reads write only a
+// per-thread slot, writers drain all slots. See sync.c.
 
 typedef struct RaskShared RaskShared;
 
@@ -3,6 +3,10 @@
 // Rask runtime — print functions, I/O, resource tracking, and entry point.
 // Collection and string implementations live in vec.c, map.c, pool.c, string.c.
 
+// MAP_ANONYMOUS/madvise are not in strict POSIX; the Makefile builds
+// with -std=c11 -D_POSIX_C_SOURCE, so opt into the BSD/glibc extras here.
+#define _DEFAULT_SOURCE
+
 #include "rask_runtime.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -11,6 +15,9 @@
 #include <fcntl.h>
 #include <string.h>
 #include <signal.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 // Forward declaration — user's main function, exported from the Rask module as rask_main
 extern void rask_main(void);
@@ -199,6 +206,103 @@ RaskVec *rask_fs_read_lines(const RaskStr *path) {
     return v;
 }
 
+// ─── Streaming line reader (fs.lines) ─────────────────────────────
+//
+// One read syscall per chunk instead of one allocation per line.
+// The chunk buffer is a heap string; next() hands out slice views of
+// it (SSO for short lines), so a 10M-line scan does ~filesize/64K
+// allocations. Views pin the chunk via its refcount — a new chunk is
+// allocated only when the program kept a line from the old one alive.
+// Reads go through rask_async_read so green-scheduler I/O engines can
+// intercept them once state-machine lowering lands.
+
+#define LINE_READER_CHUNK 65536
+
+typedef struct {
+    int     fd;
+    int     eof;
+    RaskStr chunk;   // heap buffer; line views share its refcount
+    int64_t cap;     // chunk capacity
+    int64_t pos;     // scan position within chunk
+    int64_t len;     // valid bytes in chunk
+    RaskStr current; // transfer slot for next() — caller takes ownership
+} RaskLineReader;
+
+int64_t rask_fs_lines(const RaskStr *path) {
+    RaskLineReader *r = (RaskLineReader *)rask_alloc(sizeof(RaskLineReader));
+    r->fd = open(rask_string_ptr(path), O_RDONLY);
+    r->eof = (r->fd < 0);
+    rask_string_alloc_buffer(&r->chunk, LINE_READER_CHUNK);
+    rask_string_set_len(&r->chunk, 0);
+    r->cap = LINE_READER_CHUNK;
+    r->pos = 0;
+    r->len = 0;
+    rask_string_new(&r->current);
+    return (int64_t)(uintptr_t)r;
+}
+
+// Pull the next chunk, carrying over a partial line from the tail.
+// Reuses the buffer in place when no line views pin it.
+static void line_reader_fill(RaskLineReader *r) {
+    int64_t carry = r->len - r->pos;
+    char *data;
+    if (rask_string_is_unique(&r->chunk) && carry < r->cap) {
+        data = (char *)rask_string_bytes(&r->chunk);
+        if (carry > 0 && r->pos > 0) memmove(data, data + r->pos, (size_t)carry);
+    } else {
+        // Views pin the old chunk, or an unterminated line fills it —
+        // allocate fresh, doubling so a long line always makes progress
+        RaskStr fresh;
+        int64_t cap = LINE_READER_CHUNK;
+        while (cap <= carry) cap *= 2;
+        data = rask_string_alloc_buffer(&fresh, cap);
+        if (carry > 0) memcpy(data, rask_string_bytes(&r->chunk) + r->pos, (size_t)carry);
+        rask_string_free(&r->chunk);
+        r->chunk = fresh;
+        r->cap = cap;
+    }
+    r->pos = 0;
+    r->len = carry;
+    int64_t n = rask_async_read(r->fd, data + r->len, r->cap - r->len);
+    if (n <= 0) r->eof = 1;
+    else r->len += n;
+    rask_string_set_len(&r->chunk, r->len);
+}
+
+// Next line without its newline (CRLF handled), or NULL at EOF.
+// Returned string is owned by the caller.
+const RaskStr *rask_line_reader_next(int64_t reader_ptr) {
+    RaskLineReader *r = (RaskLineReader *)(uintptr_t)reader_ptr;
+    if (!r) return NULL;
+    for (;;) {
+        const char *data = rask_string_bytes(&r->chunk);
+        const char *nl = memchr(data + r->pos, '\n', (size_t)(r->len - r->pos));
+        if (nl) {
+            int64_t end = nl - data;
+            int64_t start = r->pos;
+            r->pos = end + 1;
+            if (end > start && data[end - 1] == '\r') end--;
+            rask_string_substr(&r->current, &r->chunk, start, end);
+            return &r->current;
+        }
+        if (r->eof) {
+            if (r->pos >= r->len) return NULL;
+            rask_string_substr(&r->current, &r->chunk, r->pos, r->len);
+            r->pos = r->len;
+            return &r->current;
+        }
+        line_reader_fill(r);
+    }
+}
+
+void rask_line_reader_free(int64_t reader_ptr) {
+    RaskLineReader *r = (RaskLineReader *)(uintptr_t)reader_ptr;
+    if (!r) return;
+    if (r->fd >= 0) close(r->fd);
+    rask_string_free(&r->chunk);
+    rask_free(r);
+}
+
 // ─── IO module ────────────────────────────────────────────────────
 
 void rask_io_read_line(RaskStr *out) {
@@ -230,6 +334,50 @@ void rask_fs_read_file(RaskStr *out, const RaskStr *path) {
     rask_free(buf);
 }
 
+// Memory-map a file read-only as a zero-copy string. No read, no copy —
+// the kernel pages the file in on demand (madvise SEQUENTIAL for
+// streaming reads), and rask_string_free munmaps when the last
+// reference drops. Falls back to rask_fs_read_file if mapping fails;
+// empty string if the file can't be opened.
+void rask_fs_map_file(RaskStr *out, const RaskStr *path) {
+    const char *p = rask_string_ptr(path);
+    int fd = open(p, O_RDONLY);
+    if (fd < 0) { rask_string_new(out); return; }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        rask_string_new(out);
+        return;
+    }
+    int64_t size = (int64_t)st.st_size;
+    if (size == 0) { close(fd); rask_string_new(out); return; }
+
+    // Layout: [anon header page][file pages][zero tail page if needed].
+    // The partial last file page is zero-filled by the kernel, so the
+    // byte after the content is always a readable NUL.
+    long page = sysconf(_SC_PAGESIZE);
+    uint64_t file_pages = (((uint64_t)size + page - 1) / page) * page;
+    uint64_t total = (uint64_t)page + file_pages
+                   + (size % page == 0 ? (uint64_t)page : 0);
+    uint8_t *base = (uint8_t *)mmap(NULL, total, PROT_READ | PROT_WRITE,
+                                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        close(fd);
+        rask_fs_read_file(out, path);
+        return;
+    }
+    if (mmap(base + page, file_pages, PROT_READ, MAP_PRIVATE | MAP_FIXED,
+             fd, 0) == MAP_FAILED) {
+        munmap(base, total);
+        close(fd);
+        rask_fs_read_file(out, path);
+        return;
+    }
+    madvise(base + page, file_pages, MADV_SEQUENTIAL);
+    close(fd);
+    rask_string_adopt_mapping(out, base, total, size);
+}
+
 void rask_fs_write_file(const RaskStr *path, const RaskStr *content) {
     const char *p = rask_string_ptr(path);
     const char *c = rask_string_ptr(content);
@@ -462,10 +610,18 @@ RaskVec *rask_file_lines(int64_t file) {
 // ─── Net module ───────────────────────────────────────────────────
 
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <arpa/inet.h>
 #include <netdb.h>
 
+static int64_t net_writev_all(int fd, struct iovec *iov, int iovcnt);
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
 int64_t rask_net_tcp_listen(const RaskStr *addr) {
     const char *a = rask_string_ptr(addr);
 
@@ -507,9 +663,21 @@ int64_t rask_net_tcp_listen(const RaskStr *addr) {
 
 int64_t rask_net_tcp_accept(int64_t listen_fd) {
     int client = accept((int)listen_fd, NULL, NULL);
+    if (client >= 0) {
+        // Request/response traffic — don't let Nagle hold small segments
+        int one = 1;
+        setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
     return (int64_t)client;
 }
 
+// TCP_CORK control: batch small writes into full segments, flush on
+// uncork. Used around multi-part responses that can't go in one writev.
+void rask_net_set_cork(int64_t fd, int64_t on) {
+    int val = (int)on;
+    setsockopt((int)fd, IPPROTO_TCP, TCP_CORK, &val, sizeof(val));
+}
+
 int64_t rask_net_tcp_connect(const RaskStr *addr) {
     const char *a = rask_string_ptr(addr);
 
@@ -551,6 +719,8 @@ int64_t rask_net_tcp_connect(const RaskStr *addr) {
     }
 
     freeaddrinfo(result);
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
     return (int64_t)fd;
 }
 
@@ -786,19 +956,29 @@ int64_t rask_http_write_response(int64_t conn_fd, int64_t response_ptr) {
     rask_string_free(&out);
     out = tmp;
 
-    // Write header + body
-    rask_io_write_string(conn_fd, (int64_t)(uintptr_t)&out);
+    // Header + body in one writev — one syscall, one TCP segment for
+    // small responses
+    struct iovec iov[2];
+    iov[0].iov_base = (void *)rask_string_bytes(&out);
+    iov[0].iov_len = (size_t)rask_string_len(&out);
+    int iovcnt = 1;
     if (body_len > 0) {
-        rask_io_write_string(conn_fd, (int64_t)(uintptr_t)body);
+        iov[1].iov_base = (void *)rask_string_bytes(body);
+        iov[1].iov_len = (size_t)body_len;
+        iovcnt = 2;
     }
+    int64_t rc = net_writev_all((int)conn_fd, iov, iovcnt);
 
     rask_string_free(&out);
-    return 0;
+    return rc;
 }
 
 // Close a network socket (listening or connected).
 void rask_net_close(int64_t fd) {
-    if (fd >= 0) close((int)fd);
+    if (fd >= 0) {
+        rask_io_forget_fd((int)fd);
+        close((int)fd);
+    }
 }
 
 // Close an HttpServer — extracts the listener fd from the struct
@@ -851,6 +1031,62 @@ int64_t rask_net_write_all(int64_t fd, int64_t str_ptr) {
     return 0;
 }
 
+// Write all segments with writev, advancing past partial writes.
+// One syscall in the common case instead of one per segment.
+static int64_t net_writev_all(int fd, struct iovec *iov, int iovcnt) {
+    while (iovcnt > 0) {
+        ssize_t n = writev(fd, iov, iovcnt);
+        if (n < 0) return -1;
+        size_t left = (size_t)n;
+        while (iovcnt > 0 && left >= iov[0].iov_len) {
+            left -= iov[0].iov_len;
+            iov++;
+            iovcnt--;
+        }
+        if (left > 0) {
+            iov[0].iov_base = (char *)iov[0].iov_base + left;
+            iov[0].iov_len -= left;
+        }
+    }
+    return 0;
+}
+
+// Vectored write: all strings in `segments` (Vec of RaskStr) in one
+// submission. Corks around the batch when it spans multiple writev
+// calls so no partial segment leaves as its own TCP packet.
+int64_t rask_net_write_many(int64_t fd, RaskVec *segments) {
+    int64_t count = rask_vec_len(segments);
+    if (count == 0) return 0;
+    struct iovec stack_iov[16];
+    struct iovec *iov = stack_iov;
+    if (count > 16) iov = (struct iovec *)rask_alloc(count * (int64_t)sizeof(struct iovec));
+    int iovcnt = 0;
+    for (int64_t i = 0; i < count; i++) {
+        const RaskStr *s = (const RaskStr *)rask_vec_get(segments, i);
+        int64_t len = rask_string_len(s);
+        if (len == 0) continue;
+        iov[iovcnt].iov_base = (void *)rask_string_bytes(s);
+        iov[iovcnt].iov_len = (size_t)len;
+        iovcnt++;
+    }
+    int64_t rc = 0;
+    if (iovcnt > IOV_MAX) {
+        rask_net_set_cork(fd, 1);
+        struct iovec *p = iov;
+        while (iovcnt > 0 && rc == 0) {
+            int batch = iovcnt > IOV_MAX ? IOV_MAX : iovcnt;
+            rc = net_writev_all((int)fd, p, batch);
+            p += batch;
+            iovcnt -= batch;
+        }
+        rask_net_set_cork(fd, 0);
+    } else if (iovcnt > 0) {
+        rc = net_writev_all((int)fd, iov, iovcnt);
+    }
+    if (iov != stack_iov) rask_free(iov);
+    return rc;
+}
+
 // Get the remote address of a TCP connection as "ip:port" string.
 void rask_net_remote_addr(RaskStr *out, int64_t fd) {
     struct sockaddr_in addr;
@@ -1282,16 +1518,319 @@ static void json_buf_append_escaped(struct RaskJsonBuf *b, const char *s, int64_
     json_buf_append(b, "\"", 1);
 }
 
-RaskJsonBuf *rask_json_buf_new(void) {
-    RaskJsonBuf *b = (RaskJsonBuf *)rask_alloc(sizeof(RaskJsonBuf));
-    b->cap = 256;
-    b->data = (char *)rask_alloc(b->cap);
+
+// ── Number formatting ──
+//
+// Digit formatting dominates encode profiles, so integers go through a
+// two-digits-at-a-time itoa and doubles through Grisu2 (shortest
+// round-trip digits via 64-bit diy floats and cached powers of ten)
+// instead of snprintf.
+
+static const char json_digit_pairs[201] =
+    "00010203040506070809101112131415161718192021222324"
+    "25262728293031323334353637383940414243444546474849"
+    "50515253545556575859606162636465666768697071727374"
+    "75767778798081828384858687888990919293949596979899";
+
+static int json_fmt_i64(char *out, int64_t v) {
+    char *p = out;
+    uint64_t u = (uint64_t)v;
+    if (v < 0) {
+        *p++ = '-';
+        u = 0 - u;
+    }
+    char tmp[20];
+    int i = 20;
+    while (u >= 100) {
+        unsigned idx = (unsigned)(u % 100) * 2;
+        u /= 100;
+        tmp[--i] = json_digit_pairs[idx + 1];
+        tmp[--i] = json_digit_pairs[idx];
+    }
+    if (u >= 10) {
+        unsigned idx = (unsigned)u * 2;
+        tmp[--i] = json_digit_pairs[idx + 1];
+        tmp[--i] = json_digit_pairs[idx];
+    } else {
+        tmp[--i] = (char)('0' + u);
+    }
+    memcpy(p, tmp + i, (size_t)(20 - i));
+    return (int)(p - out) + 20 - i;
+}
+
+// diy float: u64 significand, binary exponent
+struct JsonDiyFp {
+    uint64_t f;
+    int e;
+};
+
+// Rounded 64x64→high-64 multiply via 32-bit halves (keeps -Wpedantic
+// happy, no __int128)
+static struct JsonDiyFp json_diy_mul(struct JsonDiyFp x, struct JsonDiyFp y) {
+    const uint64_t M32 = 0xFFFFFFFFULL;
+    uint64_t a = x.f >> 32, b = x.f & M32;
+    uint64_t c = y.f >> 32, d = y.f & M32;
+    uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+    uint64_t mid = (bd >> 32) + (ad & M32) + (bc & M32) + (1ULL << 31);
+    struct JsonDiyFp r = { ac + (ad >> 32) + (bc >> 32) + (mid >> 32),
+                           x.e + y.e + 64 };
+    return r;
+}
+
+// Normalized significands of 10^k, k = -348 + 8i
+static const uint64_t json_pow10_f[87] = {
+    UINT64_C(0xFA8FD5A0081C0288), UINT64_C(0xBAAEE17FA23EBF76), UINT64_C(0x8B16FB203055AC76),
+    UINT64_C(0xCF42894A5DCE35EA), UINT64_C(0x9A6BB0AA55653B2D), UINT64_C(0xE61ACF033D1A45DF),
+    UINT64_C(0xAB70FE17C79AC6CA), UINT64_C(0xFF77B1FCBEBCDC4F), UINT64_C(0xBE5691EF416BD60C),
+    UINT64_C(0x8DD01FAD907FFC3C), UINT64_C(0xD3515C2831559A83), UINT64_C(0x9D71AC8FADA6C9B5),
+    UINT64_C(0xEA9C227723EE8BCB), UINT64_C(0xAECC49914078536D), UINT64_C(0x823C12795DB6CE57),
+    UINT64_C(0xC21094364DFB5637), UINT64_C(0x9096EA6F3848984F), UINT64_C(0xD77485CB25823AC7),
+    UINT64_C(0xA086CFCD97BF97F4), UINT64_C(0xEF340A98172AACE5), UINT64_C(0xB23867FB2A35B28E),
+    UINT64_C(0x84C8D4DFD2C63F3B), UINT64_C(0xC5DD44271AD3CDBA), UINT64_C(0x936B9FCEBB25C996),
+    UINT64_C(0xDBAC6C247D62A584), UINT64_C(0xA3AB66580D5FDAF6), UINT64_C(0xF3E2F893DEC3F126),
+    UINT64_C(0xB5B5ADA8AAFF80B8), UINT64_C(0x87625F056C7C4A8B), UINT64_C(0xC9BCFF6034C13053),
+    UINT64_C(0x964E858C91BA2655), UINT64_C(0xDFF9772470297EBD), UINT64_C(0xA6DFBD9FB8E5B88F),
+    UINT64_C(0xF8A95FCF88747D94), UINT64_C(0xB94470938FA89BCF), UINT64_C(0x8A08F0F8BF0F156B),
+    UINT64_C(0xCDB02555653131B6), UINT64_C(0x993FE2C6D07B7FAC), UINT64_C(0xE45C10C42A2B3B06),
+    UINT64_C(0xAA242499697392D3), UINT64_C(0xFD87B5F28300CA0E), UINT64_C(0xBCE5086492111AEB),
+    UINT64_C(0x8CBCCC096F5088CC), UINT64_C(0xD1B71758E219652C), UINT64_C(0x9C40000000000000),
+    UINT64_C(0xE8D4A51000000000), UINT64_C(0xAD78EBC5AC620000), UINT64_C(0x813F3978F8940984),
+    UINT64_C(0xC097CE7BC90715B3), UINT64_C(0x8F7E32CE7BEA5C70), UINT64_C(0xD5D238A4ABE98068),
+    UINT64_C(0x9F4F2726179A2245), UINT64_C(0xED63A231D4C4FB27), UINT64_C(0xB0DE65388CC8ADA8),
+    UINT64_C(0x83C7088E1AAB65DB), UINT64_C(0xC45D1DF942711D9A), UINT64_C(0x924D692CA61BE758),
+    UINT64_C(0xDA01EE641A708DEA), UINT64_C(0xA26DA3999AEF774A), UINT64_C(0xF209787BB47D6B85),
+    UINT64_C(0xB454E4A179DD1877), UINT64_C(0x865B86925B9BC5C2), UINT64_C(0xC83553C5C8965D3D),
+    UINT64_C(0x952AB45CFA97A0B3), UINT64_C(0xDE469FBD99A05FE3), UINT64_C(0xA59BC234DB398C25),
+    UINT64_C(0xF6C69A72A3989F5C), UINT64_C(0xB7DCBF5354E9BECE), UINT64_C(0x88FCF317F22241E2),
+    UINT64_C(0xCC20CE9BD35C78A5), UINT64_C(0x98165AF37B2153DF), UINT64_C(0xE2A0B5DC971F303A),
+    UINT64_C(0xA8D9D1535CE3B396), UINT64_C(0xFB9B7CD9A4A7443C), UINT64_C(0xBB764C4CA7A44410),
+    UINT64_C(0x8BAB8EEFB6409C1A), UINT64_C(0xD01FEF10A657842C), UINT64_C(0x9B10A4E5E9913129),
+    UINT64_C(0xE7109BFBA19C0C9D), UINT64_C(0xAC2820D9623BF429), UINT64_C(0x80444B5E7AA7CF85),
+    UINT64_C(0xBF21E44003ACDD2D), UINT64_C(0x8E679C2F5E44FF8F), UINT64_C(0xD433179D9C8CB841),
+    UINT64_C(0x9E19DB92B4E31BA9), UINT64_C(0xEB96BF6EBADF77D9), UINT64_C(0xAF87023B9BF0EE6B),
+};
+static const int16_t json_pow10_e[87] = {
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980, -954, -927,
+    -901, -874, -847, -821, -794, -768, -741, -715, -688, -661, -635, -608,
+    -582, -555, -529, -502, -475, -449, -422, -396, -369, -343, -316, -289,
+    -263, -236, -210, -183, -157, -130, -103, -77, -50, -24, 3, 30,
+    56, 83, 109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+    375, 402, 428, 455, 481, 508, 534, 561, 588, 614, 641, 667,
+    694, 720, 747, 774, 800, 827, 853, 880, 907, 933, 960, 986,
+    1013, 1039, 1066,
+};
+
+// Cached power with binary exponent bringing w.e + e + 64 into Grisu's
+// working range
+static struct JsonDiyFp json_cached_power(int e, int *K) {
+    double dk = (-61 - e) * 0.30102999566398114 + 347;
+    int k = (int)dk;
+    if (dk - k > 0.0) k++;
+    unsigned idx = (unsigned)((k >> 3) + 1);
+    *K = -(-348 + (int)(idx << 3));
+    struct JsonDiyFp r = { json_pow10_f[idx], json_pow10_e[idx] };
+    return r;
+}
+
+static void json_grisu_round(char *buffer, int len, uint64_t delta,
+                             uint64_t rest, uint64_t ten_kappa, uint64_t wp_w) {
+    while (rest < wp_w && delta - rest >= ten_kappa
+           && (rest + ten_kappa < wp_w
+               || wp_w - rest > rest + ten_kappa - wp_w)) {
+        buffer[len - 1]--;
+        rest += ten_kappa;
+    }
+}
+
+// Generate shortest digits for W within [W-delta, W]; Mp is the scaled
+// upper boundary
+static int json_digit_gen(struct JsonDiyFp W, struct JsonDiyFp Mp,
+                          uint64_t delta, char *buffer, int *K) {
+    static const uint64_t kPow10[] = {
+        1, 10, 100, 1000, 10000, 100000,
+        1000000, 10000000, 100000000, 1000000000
+    };
+    const struct JsonDiyFp one = { 1ULL << -Mp.e, Mp.e };
+    const uint64_t wp_w = Mp.f - W.f;
+    uint32_t p1 = (uint32_t)(Mp.f >> -one.e);
+    uint64_t p2 = Mp.f & (one.f - 1);
+    int kappa = 10;
+    while (kappa > 1 && p1 < kPow10[kappa - 1]) kappa--;
+    int len = 0;
+    while (kappa > 0) {
+        uint32_t div = (uint32_t)kPow10[kappa - 1];
+        uint32_t d = p1 / div;
+        p1 %= div;
+        if (d || len) buffer[len++] = (char)('0' + d);
+        kappa--;
+        uint64_t rest = ((uint64_t)p1 << -one.e) + p2;
+        if (rest <= delta) {
+            *K += kappa;
+            json_grisu_round(buffer, len, delta, rest,
+                             kPow10[kappa] << -one.e, wp_w);
+            return len;
+        }
+    }
+    for (;;) {
+        p2 *= 10;
+        delta *= 10;
+        char d = (char)(p2 >> -one.e);
+        if (d || len) buffer[len++] = (char)('0' + d);
+        p2 &= one.f - 1;
+        kappa--;
+        if (p2 < delta) {
+            *K += kappa;
+            json_grisu_round(buffer, len, delta, p2, one.f,
+                             wp_w * kPow10[-kappa]);
+            return len;
+        }
+    }
+}
+
+static int json_grisu2(double value, char *buffer, int *K) {
+    uint64_t bits;
+    memcpy(&bits, &value, 8);
+    int biased_e = (int)((bits >> 52) & 0x7FF);
+    uint64_t sig = bits & ((1ULL << 52) - 1);
+    struct JsonDiyFp v;
+    if (biased_e) {
+        v.f = sig + (1ULL << 52);
+        v.e = biased_e - 1075;
+    } else {
+        v.f = sig;
+        v.e = -1074;
+    }
+
+    // boundaries: (v- + v)/2 and (v + v+)/2, normalized to a shared exponent
+    struct JsonDiyFp plus = { (v.f << 1) + 1, v.e - 1 };
+    while (!(plus.f & (1ULL << 63))) {
+        plus.f <<= 1;
+        plus.e--;
+    }
+    struct JsonDiyFp minus;
+    if (v.f == (1ULL << 52) && biased_e > 1) {
+        minus.f = (v.f << 2) - 1;
+        minus.e = v.e - 2;
+    } else {
+        minus.f = (v.f << 1) - 1;
+        minus.e = v.e - 1;
+    }
+    minus.f <<= minus.e - plus.e;
+    minus.e = plus.e;
+
+    struct JsonDiyFp w = v;
+    while (!(w.f & (1ULL << 63))) {
+        w.f <<= 1;
+        w.e--;
+    }
+
+    *K = 0;
+    struct JsonDiyFp c_mk = json_cached_power(plus.e, K);
+    struct JsonDiyFp W = json_diy_mul(w, c_mk);
+    struct JsonDiyFp Wp = json_diy_mul(plus, c_mk);
+    struct JsonDiyFp Wm = json_diy_mul(minus, c_mk);
+    Wm.f++;
+    Wp.f--;
+    return json_digit_gen(W, Wp, Wp.f - Wm.f, buffer, K);
+}
+
+// Format a double: shortest round-trip digits, %g-style placement of
+// the decimal point. Non-finite values encode as null (JSON has no
+// NaN/Inf).
+static int json_fmt_f64(char *out, double value) {
+    if (value != value || value > 1.7976931348623157e308
+        || value < -1.7976931348623157e308) {
+        memcpy(out, "null", 4);
+        return 4;
+    }
+    char *p = out;
+    if (value == 0.0) {
+        *p++ = '0';
+        return 1;
+    }
+    if (value < 0) {
+        *p++ = '-';
+        value = -value;
+    }
+    char digits[20];
+    int K;
+    int len = json_grisu2(value, digits, &K);
+    int kk = len + K; // position of the decimal point
+
+    if (0 < kk && kk <= 21) {
+        memcpy(p, digits, (size_t)len);
+        if (K >= 0) {
+            for (int i = len; i < kk; i++) p[i] = '0'; // trailing zeros
+            p += kk;
+        } else {
+            memmove(p + kk + 1, p + kk, (size_t)(len - kk));
+            p[kk] = '.';
+            p += len + 1;
+        }
+    } else if (-6 < kk && kk <= 0) {
+        *p++ = '0';
+        *p++ = '.';
+        for (int i = 0; i < -kk; i++) *p++ = '0';
+        memcpy(p, digits, (size_t)len);
+        p += len;
+    } else {
+        *p++ = digits[0];
+        if (len > 1) {
+            *p++ = '.';
+            memcpy(p, digits + 1, (size_t)(len - 1));
+            p += len - 1;
+        }
+        *p++ = 'e';
+        p += json_fmt_i64(p, kk - 1);
+    }
+    return (int)(p - out);
+}
+
+// ── Buffer reuse ──
+//
+// finish parks the buffer on a per-thread shelf instead of freeing it;
+// the next encode on this thread starts with the grown capacity rather
+// than re-growing from 256. A serialization loop settles at its peak
+// response size after one iteration.
+#define JSON_BUF_CACHE 4
+static __thread RaskJsonBuf *tl_json_buf_cache[JSON_BUF_CACHE];
+static __thread int tl_json_buf_cached;
+
+static RaskJsonBuf *json_buf_open(char bracket) {
+    RaskJsonBuf *b;
+    if (tl_json_buf_cached > 0) {
+        b = tl_json_buf_cache[--tl_json_buf_cached];
+    } else {
+        b = (RaskJsonBuf *)rask_alloc(sizeof(RaskJsonBuf));
+        b->cap = 256;
+        b->data = (char *)rask_alloc(b->cap);
+    }
     b->len = 0;
     b->field_count = 0;
-    json_buf_append_cstr(b, "{");
+    b->data[b->len++] = bracket;
     return b;
 }
 
+static void json_buf_retire(RaskJsonBuf *b) {
+    if (tl_json_buf_cached < JSON_BUF_CACHE) {
+        tl_json_buf_cache[tl_json_buf_cached++] = b;
+    } else {
+        rask_free(b->data);
+        rask_free(b);
+    }
+}
+
+RaskJsonBuf *rask_json_buf_new(void) {
+    return json_buf_open('{');
+}
+
+// Truncate back to the opening bracket: a buffer held across responses
+// serializes the next one without touching the allocator.
+void rask_json_buf_reset(RaskJsonBuf *buf) {
+    buf->len = 1;
+    buf->field_count = 0;
+}
+
 void rask_json_buf_add_string(RaskJsonBuf *buf, const RaskStr *key, const RaskStr *val) {
     if (buf->field_count > 0) json_buf_append_cstr(buf, ",");
     json_buf_append_escaped(buf, rask_string_ptr(key), rask_string_len(key));
@@ -1303,18 +1842,18 @@ void rask_json_buf_add_string(RaskJsonBuf *buf, const RaskStr *key, const RaskSt
 void rask_json_buf_add_i64(RaskJsonBuf *buf, const RaskStr *key, int64_t val) {
     if (buf->field_count > 0) json_buf_append_cstr(buf, ",");
     json_buf_append_escaped(buf, rask_string_ptr(key), rask_string_len(key));
-    char num[32];
-    snprintf(num, sizeof(num), ":%lld", (long long)val);
-    json_buf_append_cstr(buf, num);
+    char num[24];
+    num[0] = ':';
+    json_buf_append(buf, num, 1 + json_fmt_i64(num + 1, val));
     buf->field_count++;
 }
 
 void rask_json_buf_add_f64(RaskJsonBuf *buf, const RaskStr *key, double val) {
     if (buf->field_count > 0) json_buf_append_cstr(buf, ",");
     json_buf_append_escaped(buf, rask_string_ptr(key), rask_string_len(key));
-    char num[64];
-    snprintf(num, sizeof(num), ":%g", val);
-    json_buf_append_cstr(buf, num);
+    char num[32];
+    num[0] = ':';
+    json_buf_append(buf, num, 1 + json_fmt_f64(num + 1, val));
     buf->field_count++;
 }
 
@@ -1336,20 +1875,13 @@ void rask_json_buf_add_raw(RaskJsonBuf *buf, const RaskStr *key, const RaskStr *
 void rask_json_buf_finish(RaskStr *out, RaskJsonBuf *buf) {
     json_buf_append_cstr(buf, "}");
     rask_string_from_bytes(out, buf->data, buf->len);
-    rask_free(buf->data);
-    rask_free(buf);
+    json_buf_retire(buf);
 }
 
 // ─── JSON array buffer ──────────────────────────────────────────
 
 RaskJsonBuf *rask_json_buf_new_array(void) {
-    RaskJsonBuf *b = (RaskJsonBuf *)rask_alloc(sizeof(RaskJsonBuf));
-    b->cap = 256;
-    b->data = (char *)rask_alloc(b->cap);
-    b->len = 0;
-    b->field_count = 0;
-    json_buf_append_cstr(b, "[");
-    return b;
+    return json_buf_open('[');
 }
 
 void rask_json_buf_array_add_raw(RaskJsonBuf *buf, const RaskStr *raw_json) {
@@ -1366,17 +1898,15 @@ void rask_json_buf_array_add_string(RaskJsonBuf *buf, const RaskStr *val) {
 
 void rask_json_buf_array_add_i64(RaskJsonBuf *buf, int64_t val) {
     if (buf->field_count > 0) json_buf_append_cstr(buf, ",");
-    char num[32];
-    snprintf(num, sizeof(num), "%lld", (long long)val);
-    json_buf_append_cstr(buf, num);
+    char num[24];
+    json_buf_append(buf, num, json_fmt_i64(num, val));
     buf->field_count++;
 }
 
 void rask_json_buf_array_add_f64(RaskJsonBuf *buf, double val) {
     if (buf->field_count > 0) json_buf_append_cstr(buf, ",");
-    char num[64];
-    snprintf(num, sizeof(num), "%g", val);
-    json_buf_append_cstr(buf, num);
+    char num[32];
+    json_buf_append(buf, num, json_fmt_f64(num, val));
     buf->field_count++;
 }
 
@@ -1389,8 +1919,7 @@ void rask_json_buf_array_add_bool(RaskJsonBuf *buf, int64_t val) {
 void rask_json_buf_finish_array(RaskStr *out, RaskJsonBuf *buf) {
     json_buf_append_cstr(buf, "]");
     rask_string_from_bytes(out, buf->data, buf->len);
-    rask_free(buf->data);
-    rask_free(buf);
+    json_buf_retire(buf);
 }
 
 void rask_json_encode_string(RaskStr *out, const RaskStr *s) {
@@ -1405,162 +1934,313 @@ void rask_json_encode_string(RaskStr *out, const RaskStr *s) {
 }
 
 void rask_json_encode_i64(RaskStr *out, int64_t val) {
-    char buf[32];
-    int len = snprintf(buf, sizeof(buf), "%lld", (long long)val);
-    rask_string_from_bytes(out, buf, (int64_t)len);
+    char buf[24];
+    rask_string_from_bytes(out, buf, json_fmt_i64(buf, val));
 }
 
 // ─── JSON decode ──────────────────────────────────────────────────
-
-#define JSON_MAX_FIELDS 64
+//
+// Two-stage parser in the simdjson mold. Stage 1 scans the raw buffer
+// in 64-byte blocks, building bitmasks of backslashes, quotes, and
+// structural characters, resolves escapes and in-string spans with
+// branch-free bit arithmetic, and records the positions of structural
+// characters outside strings. Stage 2 walks that index and stores each
+// top-level field as offsets into the input — no values materialize
+// until a getter asks. rask_json_get_string returns a zero-copy slice
+// of the input (a copy only when the value needs unescaping), so an
+// ingest loop over an mmap'd file never touches the allocator.
 
 struct RaskJsonField {
-    char key[128];
-    enum { JSON_STRING, JSON_NUMBER, JSON_BOOL } type;
-    union {
-        RaskStr str_val;
-        double num_val;
-        int8_t bool_val;
-    };
+    uint32_t key_off, key_len;
+    uint32_t val_off, val_len;
+    enum { JSON_STRING, JSON_NUMBER, JSON_BOOL, JSON_NULL, JSON_RAW } type;
 };
 
 struct RaskJsonObj {
-    struct RaskJsonField fields[JSON_MAX_FIELDS];
-    int count;
+    RaskStr src;                 // clone of the input; slices share its buffer
+    struct RaskJsonField *fields;
+    int32_t count, cap;
 };
 
-static void json_skip_ws(const char **p) {
-    while (**p == ' ' || **p == '\t' || **p == '\n' || **p == '\r') (*p)++;
-}
+// ── Stage 1: structural index ──
+
+struct JsonMasks {
+    uint64_t bs, quote, structural;
+};
 
-static void json_parse_string(RaskStr *out, const char **p) {
-    if (**p != '"') { rask_string_new(out); return; }
-    (*p)++;
-    // Scan for closing quote to know total length
-    const char *start = *p;
-    int has_escapes = 0;
-    while (**p && **p != '"') {
-        if (**p == '\\') { has_escapes = 1; (*p)++; if (**p) (*p)++; }
-        else (*p)++;
+static void json_masks_scalar(const uint8_t *b, struct JsonMasks *m) {
+    m->bs = m->quote = m->structural = 0;
+    for (int i = 0; i < 64; i++) {
+        uint8_t c = b[i];
+        uint64_t bit = 1ULL << i;
+        if (c == '\\') m->bs |= bit;
+        else if (c == '"') m->quote |= bit;
+        else if (c == '{' || c == '}' || c == '[' || c == ']'
+                 || c == ':' || c == ',')
+            m->structural |= bit;
     }
-    if (!has_escapes) {
-        // Fast path: no escapes, just copy the raw bytes
-        rask_string_from_bytes(out, start, (int64_t)(*p - start));
-        if (**p == '"') (*p)++;
-        return;
+}
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define JSON_X86_DISPATCH 1
+#include <immintrin.h>
+
+__attribute__((target("avx2")))
+static uint64_t json_cmpeq64(__m256i lo, __m256i hi, char c) {
+    __m256i v = _mm256_set1_epi8(c);
+    uint32_t mlo = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, v));
+    uint32_t mhi = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, v));
+    return (uint64_t)mhi << 32 | mlo;
+}
+
+__attribute__((target("avx2")))
+static void json_masks_avx2(const uint8_t *b, struct JsonMasks *m) {
+    __m256i lo = _mm256_loadu_si256((const __m256i *)b);
+    __m256i hi = _mm256_loadu_si256((const __m256i *)(b + 32));
+    m->bs    = json_cmpeq64(lo, hi, '\\');
+    m->quote = json_cmpeq64(lo, hi, '"');
+    m->structural = json_cmpeq64(lo, hi, '{') | json_cmpeq64(lo, hi, '}')
+                  | json_cmpeq64(lo, hi, '[') | json_cmpeq64(lo, hi, ']')
+                  | json_cmpeq64(lo, hi, ':') | json_cmpeq64(lo, hi, ',');
+}
+#endif
+
+typedef void (*JsonMasksFn)(const uint8_t *, struct JsonMasks *);
+static JsonMasksFn json_masks_impl;
+
+// Prefix XOR: bit i of the result is the XOR of bits 0..i. Turns the
+// quote mask into an in-string mask.
+static uint64_t json_prefix_xor(uint64_t x) {
+    x ^= x << 1;  x ^= x << 2;  x ^= x << 4;
+    x ^= x << 8;  x ^= x << 16; x ^= x << 32;
+    return x;
+}
+
+// Quotes preceded by an odd run of backslashes are escaped (simdjson's
+// odd/even sequence trick; carry tracks runs crossing block bounds).
+static uint64_t json_escaped(uint64_t bs, uint64_t *prev_escaped) {
+    bs &= ~*prev_escaped;
+    uint64_t follows = bs << 1 | *prev_escaped;
+    const uint64_t even = 0x5555555555555555ULL;
+    uint64_t odd_starts = bs & ~even & ~follows;
+    uint64_t even_carries;
+    *prev_escaped = __builtin_add_overflow(odd_starts, bs, &even_carries);
+    return (even ^ (even_carries << 1)) & follows;
+}
+
+// Positions of structural characters outside strings, plus the quotes
+// that delimit strings. Caller frees.
+static uint32_t *json_structural_index(const char *data, int64_t len,
+                                       int64_t *out_count) {
+    if (!json_masks_impl) {
+#ifdef JSON_X86_DISPATCH
+        json_masks_impl = rask_cpu_has(RASK_CPU_AVX2) ? json_masks_avx2
+                                                      : json_masks_scalar;
+#else
+        json_masks_impl = json_masks_scalar;
+#endif
     }
-    // Slow path: unescape. Reset and rebuild.
-    *p = start;
-    RaskStr s;
-    rask_string_new(&s);
-    while (**p && **p != '"') {
-        if (**p == '\\' && *(*p + 1)) {
-            char c = *(*p + 1);
-            uint8_t byte;
-            switch (c) {
-                case '"': case '\\': case '/': byte = (uint8_t)c; break;
-                case 'n': byte = '\n'; break;
-                case 't': byte = '\t'; break;
-                case 'r': byte = '\r'; break;
-                default: byte = (uint8_t)c; break;
-            }
-            RaskStr tmp;
-            rask_string_push_byte(&tmp, &s, byte);
-            rask_string_free(&s);
-            s = tmp;
-            *p += 2;
+
+    // Worst case is one entry per byte ("[[[[…", runs of closers) — the
+    // emit mask can be dense, so size for len, not an average density.
+    uint32_t *pos = (uint32_t *)rask_alloc(rask_safe_mul(
+        (len + 8), (int64_t)sizeof(uint32_t)));
+    int64_t count = 0;
+    uint64_t prev_escaped = 0, prev_in_string = 0;
+
+    for (int64_t base = 0; base < len; base += 64) {
+        struct JsonMasks m;
+        if (len - base >= 64) {
+            json_masks_impl((const uint8_t *)data + base, &m);
         } else {
-            RaskStr tmp;
-            rask_string_push_byte(&tmp, &s, (uint8_t)**p);
-            rask_string_free(&s);
-            s = tmp;
-            (*p)++;
+            uint8_t tail[64] = {0};
+            memcpy(tail, data + base, (size_t)(len - base));
+            json_masks_scalar(tail, &m);
         }
+        uint64_t quote = m.quote & ~json_escaped(m.bs, &prev_escaped);
+        uint64_t in_string = json_prefix_xor(quote) ^ prev_in_string;
+        prev_in_string = (uint64_t)((int64_t)in_string >> 63);
+
+        // in_string covers [open quote, close quote); keeping the raw
+        // quote bits records both delimiters.
+        uint64_t emit = (m.structural & ~in_string) | quote;
+        while (emit) {
+            pos[count++] = (uint32_t)(base + __builtin_ctzll(emit));
+            emit &= emit - 1;
+        }
+    }
+    *out_count = count;
+    return pos;
+}
+
+// ── Stage 2: field table ──
+
+static void json_obj_push(RaskJsonObj *obj, struct RaskJsonField f) {
+    if (obj->count == obj->cap) {
+        int32_t cap = obj->cap ? obj->cap * 2 : 16;
+        struct RaskJsonField *grown = (struct RaskJsonField *)rask_alloc(
+            rask_safe_mul(cap, (int64_t)sizeof(struct RaskJsonField)));
+        memcpy(grown, obj->fields,
+               (size_t)obj->count * sizeof(struct RaskJsonField));
+        rask_free(obj->fields);
+        obj->fields = grown;
+        obj->cap = cap;
     }
-    if (**p == '"') (*p)++;
-    *out = s;
+    obj->fields[obj->count++] = f;
+}
+
+// Classify a non-string, non-container value by its first byte.
+static int json_value_type(char c) {
+    if (c == 't' || c == 'f') return JSON_BOOL;
+    if (c == 'n') return JSON_NULL;
+    return JSON_NUMBER;
 }
 
 RaskJsonObj *rask_json_parse(const RaskStr *s) {
     RaskJsonObj *obj = (RaskJsonObj *)rask_alloc(sizeof(RaskJsonObj));
     memset(obj, 0, sizeof(RaskJsonObj));
+    obj->src = *s;
+    rask_string_clone(&obj->src);
 
-    const char *p = rask_string_ptr(s);
-    json_skip_ws(&p);
-    if (*p != '{') return obj;
-    p++;
-
-    while (*p && *p != '}' && obj->count < JSON_MAX_FIELDS) {
-        json_skip_ws(&p);
-        if (*p == '}') break;
-        if (*p == ',') { p++; json_skip_ws(&p); }
-
-        if (*p != '"') break;
-        RaskStr key;
-        json_parse_string(&key, &p);
-        struct RaskJsonField *f = &obj->fields[obj->count];
-        snprintf(f->key, sizeof(f->key), "%s", rask_string_ptr(&key));
-        rask_string_free(&key);
-
-        json_skip_ws(&p);
-        if (*p != ':') break;
-        p++;
-        json_skip_ws(&p);
-
-        if (*p == '"') {
-            f->type = JSON_STRING;
-            json_parse_string(&f->str_val, &p);
-        } else if (*p == 't' || *p == 'f') {
-            f->type = JSON_BOOL;
-            if (strncmp(p, "true", 4) == 0) { f->bool_val = 1; p += 4; }
-            else if (strncmp(p, "false", 5) == 0) { f->bool_val = 0; p += 5; }
-        } else if (*p == 'n' && strncmp(p, "null", 4) == 0) {
-            f->type = JSON_STRING;
-            rask_string_new(&f->str_val);
-            p += 4;
+    const char *data = rask_string_bytes(s);
+    int64_t len = rask_string_len(s);
+    int64_t n;
+    uint32_t *pos = json_structural_index(data, len, &n);
+
+    int64_t i = 0;
+    if (i >= n || data[pos[i]] != '{') goto done; // not a flat object
+    i++;
+
+    while (i + 3 < n && data[pos[i]] != '}') {
+        if (data[pos[i]] == ',') { i++; continue; }
+        // key: a quote pair, then ':'
+        if (data[pos[i]] != '"' || data[pos[i + 1]] != '"'
+            || data[pos[i + 2]] != ':')
+            break;
+        struct RaskJsonField f;
+        f.key_off = pos[i] + 1;
+        f.key_len = pos[i + 1] - f.key_off;
+        i += 3;
+        if (i >= n) break;
+
+        char v = data[pos[i]];
+        if (v == '"') {
+            if (i + 1 >= n) break;
+            f.type = JSON_STRING;
+            f.val_off = pos[i] + 1;
+            f.val_len = pos[i + 1] - f.val_off;
+            i += 2;
+        } else if (v == '{' || v == '[') {
+            // nested container: depth-walk the index to its close and
+            // keep the raw text
+            char open = v, close = (v == '{') ? '}' : ']';
+            int64_t depth = 0, j = i;
+            for (; j < n; j++) {
+                if (data[pos[j]] == open) depth++;
+                else if (data[pos[j]] == close && --depth == 0) break;
+            }
+            if (j >= n) break; // unbalanced
+            f.type = JSON_RAW;
+            f.val_off = pos[i];
+            f.val_len = pos[j] + 1 - f.val_off;
+            i = j + 1;
+        } else if (v == ',' || v == '}') {
+            // number/bool/null: runs from after the ':' to the next
+            // structural character, whitespace-trimmed
+            uint32_t start = pos[i - 1] + 1, end = pos[i];
+            while (start < end && (data[start] == ' ' || data[start] == '\t'
+                   || data[start] == '\n' || data[start] == '\r'))
+                start++;
+            while (end > start && (data[end - 1] == ' ' || data[end - 1] == '\t'
+                   || data[end - 1] == '\n' || data[end - 1] == '\r'))
+                end--;
+            if (start == end) break; // empty value
+            f.type = json_value_type(data[start]);
+            f.val_off = start;
+            f.val_len = end - start;
         } else {
-            f->type = JSON_NUMBER;
-            char *end;
-            f->num_val = strtod(p, &end);
-            p = end;
+            break; // malformed
         }
-        obj->count++;
+        json_obj_push(obj, f);
     }
+
+done:
+    rask_free(pos);
     return obj;
 }
 
 static struct RaskJsonField *json_find_field(RaskJsonObj *obj, const char *key) {
     if (!obj) return NULL;
-    for (int i = 0; i < obj->count; i++) {
-        if (strcmp(obj->fields[i].key, key) == 0) return &obj->fields[i];
+    size_t klen = strlen(key);
+    const char *data = rask_string_bytes(&obj->src);
+    for (int32_t i = 0; i < obj->count; i++) {
+        struct RaskJsonField *f = &obj->fields[i];
+        if (f->key_len == klen && memcmp(data + f->key_off, key, klen) == 0)
+            return f;
     }
     return NULL;
 }
 
 void rask_json_get_string(RaskStr *out, RaskJsonObj *obj, const char *key) {
     struct RaskJsonField *f = json_find_field(obj, key);
-    if (!f || f->type != JSON_STRING) { rask_string_new(out); return; }
-    // Copy the field's string value
-    *out = f->str_val;
-    rask_string_clone(out); // RC inc if heap
+    if (!f || f->type == JSON_BOOL || f->type == JSON_NUMBER) {
+        rask_string_new(out);
+        return;
+    }
+    if (f->type == JSON_NULL) { rask_string_new(out); return; }
+    const char *data = rask_string_bytes(&obj->src);
+    if (f->type == JSON_STRING
+        && memchr(data + f->val_off, '\\', f->val_len) != NULL) {
+        // Escapes force a copy: unescape into a fresh buffer
+        char *buf = (char *)rask_alloc(f->val_len);
+        int64_t w = 0;
+        for (uint32_t r = 0; r < f->val_len; r++) {
+            char c = data[f->val_off + r];
+            if (c == '\\' && r + 1 < f->val_len) {
+                char e = data[f->val_off + ++r];
+                switch (e) {
+                    case 'n': c = '\n'; break;
+                    case 't': c = '\t'; break;
+                    case 'r': c = '\r'; break;
+                    default:  c = e; break; // '"', '\\', '/', and the rest verbatim
+                }
+            }
+            buf[w++] = c;
+        }
+        rask_string_from_bytes(out, buf, w);
+        rask_free(buf);
+        return;
+    }
+    // Zero-copy: slice into the parsed input (JSON_RAW returns the raw text)
+    rask_string_substr(out, &obj->src, f->val_off, f->val_off + f->val_len);
+}
+
+// Numbers parse on demand; JSON values are short, so a stack copy gives
+// strtod a terminated view without touching the allocator.
+static double json_field_number(RaskJsonObj *obj, struct RaskJsonField *f) {
+    char buf[64];
+    uint32_t len = f->val_len < sizeof(buf) - 1 ? f->val_len : sizeof(buf) - 1;
+    memcpy(buf, rask_string_bytes(&obj->src) + f->val_off, len);
+    buf[len] = '\0';
+    return strtod(buf, NULL);
 }
 
 int64_t rask_json_get_i64(RaskJsonObj *obj, const char *key) {
     struct RaskJsonField *f = json_find_field(obj, key);
     if (!f || f->type != JSON_NUMBER) return 0;
-    return (int64_t)f->num_val;
+    return (int64_t)json_field_number(obj, f);
 }
 
 double rask_json_get_f64(RaskJsonObj *obj, const char *key) {
     struct RaskJsonField *f = json_find_field(obj, key);
     if (!f || f->type != JSON_NUMBER) return 0.0;
-    return f->num_val;
+    return json_field_number(obj, f);
 }
 
 int8_t rask_json_get_bool(RaskJsonObj *obj, const char *key) {
     struct RaskJsonField *f = json_find_field(obj, key);
     if (!f || f->type != JSON_BOOL) return 0;
-    return f->bool_val;
+    return rask_string_bytes(&obj->src)[f->val_off] == 't';
 }
 
 int64_t rask_json_decode(const RaskStr *s) {
@@ -1632,12 +2312,6 @@ void rask_resource_scope_check(int64_t scope_depth) {
     (void)scope_depth;
 }
 
-// ─── Runtime checks ──────────────────────────────────────────────
-
-// When RASK_RUNTIME_CHECKS=1 is set, null-pointer and validity checks
-// are active in the C runtime. Debug builds (RASK_DEBUG) always check.
-int rask_runtime_checks_enabled = 0;
-
 // ─── Entry point ──────────────────────────────────────────────────
 
 int main(int argc, char **argv) {
@@ -1646,7 +2320,21 @@ int main(int argc, char **argv) {
     if (checks_env && checks_env[0] == '1') {
         rask_runtime_checks_enabled = 1;
     }
+    const char *prof_env = getenv("RASK_ALLOC_PROFILE");
+    if (prof_env && prof_env[0] == '1') {
+        rask_alloc_profile_enabled = 1;
+        atexit(rask_alloc_profile_dump);
+    }
+    // Allocator swap must happen before the first allocation.
+    const char *alloc_env = getenv("RASK_ALLOC");
+    if (alloc_env && strcmp(alloc_env, "slab") == 0) {
+        RaskAllocator slab;
+        rask_slab_allocator(&slab);
+        rask_allocator_set(&slab);
+    }
+    // Pick ISA-specific kernel variants before any runtime call runs.
+    rask_cpu_init();
     rask_args_init(argc, argv);
     rask_main();
-    return 0;
+    return rask_bench_failed();
 }
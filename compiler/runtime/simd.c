@@ -12,6 +12,232 @@
 #include <float.h>
 #include <math.h>
 
+// ─── ISA dispatch for 256-bit kernels ──────────────────────
+// The runtime archive is compiled once at the baseline ISA, so the
+// f32x8/f64x4 arithmetic kernels carry AVX2 variants built with
+// per-function target attributes and selected at startup (cpu.c calls
+// rask_simd_dispatch_init before rask_main; until then the pointers
+// hold the portable fallbacks). No current lane width exceeds 256
+// bits, so an AVX-512 variant has nothing to add yet — rask_cpu_has
+// already reports RASK_CPU_AVX512F for kernels that will. On aarch64
+// NEON is baseline and the scalar loops vectorize as-is.
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SIMD_X86_DISPATCH 1
+#include <immintrin.h>
+#endif
+
+typedef void   (*F32x8BinFn)(const float *, const float *, float *);
+typedef void   (*F32x8FmaFn)(const float *, const float *, const float *, float *);
+typedef double (*F32x8SumFn)(const float *);
+
+static void f32x8_add_scalar(const float *a, const float *b, float *r) {
+    for (int i = 0; i < 8; i++) r[i] = a[i] + b[i];
+}
+
+static void f32x8_sub_scalar(const float *a, const float *b, float *r) {
+    for (int i = 0; i < 8; i++) r[i] = a[i] - b[i];
+}
+
+static void f32x8_mul_scalar(const float *a, const float *b, float *r) {
+    for (int i = 0; i < 8; i++) r[i] = a[i] * b[i];
+}
+
+static void f32x8_div_scalar(const float *a, const float *b, float *r) {
+    for (int i = 0; i < 8; i++) r[i] = a[i] / b[i];
+}
+
+static void f32x8_min_each_scalar(const float *a, const float *b, float *r) {
+    for (int i = 0; i < 8; i++) r[i] = a[i] < b[i] ? a[i] : b[i];
+}
+
+static void f32x8_max_each_scalar(const float *a, const float *b, float *r) {
+    for (int i = 0; i < 8; i++) r[i] = a[i] > b[i] ? a[i] : b[i];
+}
+
+static void f32x8_fma_scalar(const float *a, const float *b, const float *c, float *r) {
+    for (int i = 0; i < 8; i++) r[i] = fmaf(a[i], b[i], c[i]);
+}
+
+static double f32x8_sum_scalar(const float *a) {
+    float s = 0;
+    for (int i = 0; i < 8; i++) s += a[i];
+    return (double)s;
+}
+
+typedef void   (*F64x4BinFn)(const double *, const double *, double *);
+typedef void   (*F64x4FmaFn)(const double *, const double *, const double *, double *);
+typedef double (*F64x4SumFn)(const double *);
+
+static void f64x4_add_scalar(const double *a, const double *b, double *r) {
+    for (int i = 0; i < 4; i++) r[i] = a[i] + b[i];
+}
+
+static void f64x4_sub_scalar(const double *a, const double *b, double *r) {
+    for (int i = 0; i < 4; i++) r[i] = a[i] - b[i];
+}
+
+static void f64x4_mul_scalar(const double *a, const double *b, double *r) {
+    for (int i = 0; i < 4; i++) r[i] = a[i] * b[i];
+}
+
+static void f64x4_div_scalar(const double *a, const double *b, double *r) {
+    for (int i = 0; i < 4; i++) r[i] = a[i] / b[i];
+}
+
+static void f64x4_min_each_scalar(const double *a, const double *b, double *r) {
+    for (int i = 0; i < 4; i++) r[i] = a[i] < b[i] ? a[i] : b[i];
+}
+
+static void f64x4_max_each_scalar(const double *a, const double *b, double *r) {
+    for (int i = 0; i < 4; i++) r[i] = a[i] > b[i] ? a[i] : b[i];
+}
+
+static void f64x4_fma_scalar(const double *a, const double *b, const double *c, double *r) {
+    for (int i = 0; i < 4; i++) r[i] = fma(a[i], b[i], c[i]);
+}
+
+static double f64x4_sum_scalar(const double *a) {
+    double s = 0;
+    for (int i = 0; i < 4; i++) s += a[i];
+    return (double)s;
+}
+
+#ifdef SIMD_X86_DISPATCH
+
+__attribute__((target("avx2")))
+static void f32x8_add_avx2(const float *a, const float *b, float *r) {
+    _mm256_storeu_ps(r, _mm256_add_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b)));
+}
+
+__attribute__((target("avx2")))
+static void f32x8_sub_avx2(const float *a, const float *b, float *r) {
+    _mm256_storeu_ps(r, _mm256_sub_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b)));
+}
+
+__attribute__((target("avx2")))
+static void f32x8_mul_avx2(const float *a, const float *b, float *r) {
+    _mm256_storeu_ps(r, _mm256_mul_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b)));
+}
+
+__attribute__((target("avx2")))
+static void f32x8_div_avx2(const float *a, const float *b, float *r) {
+    _mm256_storeu_ps(r, _mm256_div_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b)));
+}
+
+__attribute__((target("avx2")))
+static void f32x8_min_each_avx2(const float *a, const float *b, float *r) {
+    _mm256_storeu_ps(r, _mm256_min_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b)));
+}
+
+__attribute__((target("avx2")))
+static void f32x8_max_each_avx2(const float *a, const float *b, float *r) {
+    _mm256_storeu_ps(r, _mm256_max_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b)));
+}
+
+__attribute__((target("avx2,fma")))
+static void f32x8_fma_avx2(const float *a, const float *b, const float *c, float *r) {
+    _mm256_storeu_ps(r, _mm256_fmadd_ps(_mm256_loadu_ps(a), _mm256_loadu_ps(b), _mm256_loadu_ps(c)));
+}
+
+__attribute__((target("avx2")))
+static void f64x4_add_avx2(const double *a, const double *b, double *r) {
+    _mm256_storeu_pd(r, _mm256_add_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b)));
+}
+
+__attribute__((target("avx2")))
+static void f64x4_sub_avx2(const double *a, const double *b, double *r) {
+    _mm256_storeu_pd(r, _mm256_sub_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b)));
+}
+
+__attribute__((target("avx2")))
+static void f64x4_mul_avx2(const double *a, const double *b, double *r) {
+    _mm256_storeu_pd(r, _mm256_mul_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b)));
+}
+
+__attribute__((target("avx2")))
+static void f64x4_div_avx2(const double *a, const double *b, double *r) {
+    _mm256_storeu_pd(r, _mm256_div_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b)));
+}
+
+__attribute__((target("avx2")))
+static void f64x4_min_each_avx2(const double *a, const double *b, double *r) {
+    _mm256_storeu_pd(r, _mm256_min_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b)));
+}
+
+__attribute__((target("avx2")))
+static void f64x4_max_each_avx2(const double *a, const double *b, double *r) {
+    _mm256_storeu_pd(r, _mm256_max_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b)));
+}
+
+__attribute__((target("avx2,fma")))
+static void f64x4_fma_avx2(const double *a, const double *b, const double *c, double *r) {
+    _mm256_storeu_pd(r, _mm256_fmadd_pd(_mm256_loadu_pd(a), _mm256_loadu_pd(b), _mm256_loadu_pd(c)));
+}
+
+__attribute__((target("avx2")))
+static double f32x8_sum_avx2(const float *a) {
+    __m256 v = _mm256_loadu_ps(a);
+    __m128 s = _mm_add_ps(_mm256_castps256_ps128(v),
+                          _mm256_extractf128_ps(v, 1));
+    s = _mm_hadd_ps(s, s);
+    s = _mm_hadd_ps(s, s);
+    return (double)_mm_cvtss_f32(s);
+}
+
+__attribute__((target("avx2")))
+static double f64x4_sum_avx2(const double *a) {
+    __m256d v = _mm256_loadu_pd(a);
+    __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v),
+                           _mm256_extractf128_pd(v, 1));
+    s = _mm_hadd_pd(s, s);
+    return _mm_cvtsd_f64(s);
+}
+#endif // SIMD_X86_DISPATCH
+
+static F32x8BinFn f32x8_add_impl = f32x8_add_scalar;
+static F32x8BinFn f32x8_sub_impl = f32x8_sub_scalar;
+static F32x8BinFn f32x8_mul_impl = f32x8_mul_scalar;
+static F32x8BinFn f32x8_div_impl = f32x8_div_scalar;
+static F32x8BinFn f32x8_min_each_impl = f32x8_min_each_scalar;
+static F32x8BinFn f32x8_max_each_impl = f32x8_max_each_scalar;
+static F32x8FmaFn f32x8_fma_impl = f32x8_fma_scalar;
+static F32x8SumFn f32x8_sum_impl = f32x8_sum_scalar;
+
+static F64x4BinFn f64x4_add_impl = f64x4_add_scalar;
+static F64x4BinFn f64x4_sub_impl = f64x4_sub_scalar;
+static F64x4BinFn f64x4_mul_impl = f64x4_mul_scalar;
+static F64x4BinFn f64x4_div_impl = f64x4_div_scalar;
+static F64x4BinFn f64x4_min_each_impl = f64x4_min_each_scalar;
+static F64x4BinFn f64x4_max_each_impl = f64x4_max_each_scalar;
+static F64x4FmaFn f64x4_fma_impl = f64x4_fma_scalar;
+static F64x4SumFn f64x4_sum_impl = f64x4_sum_scalar;
+
+void rask_simd_dispatch_init(void) {
+#ifdef SIMD_X86_DISPATCH
+    if (rask_cpu_has(RASK_CPU_AVX2)) {
+        f32x8_add_impl = f32x8_add_avx2;
+        f32x8_sub_impl = f32x8_sub_avx2;
+        f32x8_mul_impl = f32x8_mul_avx2;
+        f32x8_div_impl = f32x8_div_avx2;
+        f32x8_min_each_impl = f32x8_min_each_avx2;
+        f32x8_max_each_impl = f32x8_max_each_avx2;
+        f32x8_sum_impl = f32x8_sum_avx2;
+        f64x4_add_impl = f64x4_add_avx2;
+        f64x4_sub_impl = f64x4_sub_avx2;
+        f64x4_mul_impl = f64x4_mul_avx2;
+        f64x4_div_impl = f64x4_div_avx2;
+        f64x4_min_each_impl = f64x4_min_each_avx2;
+        f64x4_max_each_impl = f64x4_max_each_avx2;
+        f64x4_sum_impl = f64x4_sum_avx2;
+    }
+    if (rask_cpu_has(RASK_CPU_AVX2) && rask_cpu_has(RASK_CPU_FMA)) {
+        f32x8_fma_impl = f32x8_fma_avx2;
+        f64x4_fma_impl = f64x4_fma_avx2;
+    }
+#endif
+}
+
 // ═══════════════════════════════════════════════════════════
 // f32x4 — 4-lane single-precision float vector
 // ═══════════════════════════════════════════════════════════
@@ -107,6 +333,78 @@ void rask_simd_f32x4_set(int64_t vec, int64_t index, double val) {
     v[index] = (float)val;
 }
 
+int64_t rask_simd_f32x4_fma(int64_t a, int64_t b, int64_t c) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *vc = (float *)(uintptr_t)c;
+    float *r = rask_alloc(4 * sizeof(float));
+    for (int i = 0; i < 4; i++) r[i] = fmaf(va[i], vb[i], vc[i]);
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x4_min_each(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(4 * sizeof(float));
+    for (int i = 0; i < 4; i++) r[i] = va[i] < vb[i] ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x4_max_each(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(4 * sizeof(float));
+    for (int i = 0; i < 4; i++) r[i] = va[i] > vb[i] ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x4_eq(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(4 * sizeof(float));
+    for (int i = 0; i < 4; i++) r[i] = va[i] == vb[i] ? 1.0f : 0.0f;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x4_ne(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(4 * sizeof(float));
+    for (int i = 0; i < 4; i++) r[i] = va[i] != vb[i] ? 1.0f : 0.0f;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x4_lt(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(4 * sizeof(float));
+    for (int i = 0; i < 4; i++) r[i] = va[i] < vb[i] ? 1.0f : 0.0f;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x4_le(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(4 * sizeof(float));
+    for (int i = 0; i < 4; i++) r[i] = va[i] <= vb[i] ? 1.0f : 0.0f;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x4_gt(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(4 * sizeof(float));
+    for (int i = 0; i < 4; i++) r[i] = va[i] > vb[i] ? 1.0f : 0.0f;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x4_ge(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(4 * sizeof(float));
+    for (int i = 0; i < 4; i++) r[i] = va[i] >= vb[i] ? 1.0f : 0.0f;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x4_blend(int64_t a, int64_t b, int64_t mask) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *vm = (float *)(uintptr_t)mask;
+    float *r = rask_alloc(4 * sizeof(float));
+    for (int i = 0; i < 4; i++) r[i] = vm[i] != 0.0f ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
 // ═══════════════════════════════════════════════════════════
 // f32x8 — 8-lane single-precision float vector
 // ═══════════════════════════════════════════════════════════
@@ -131,28 +429,28 @@ void rask_simd_f32x8_store(int64_t vec, int64_t dst) {
 int64_t rask_simd_f32x8_add(int64_t a, int64_t b) {
     float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
     float *r = rask_alloc(8 * sizeof(float));
-    for (int i = 0; i < 8; i++) r[i] = va[i] + vb[i];
+    f32x8_add_impl(va, vb, r);
     return (int64_t)(uintptr_t)r;
 }
 
 int64_t rask_simd_f32x8_sub(int64_t a, int64_t b) {
     float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
     float *r = rask_alloc(8 * sizeof(float));
-    for (int i = 0; i < 8; i++) r[i] = va[i] - vb[i];
+    f32x8_sub_impl(va, vb, r);
     return (int64_t)(uintptr_t)r;
 }
 
 int64_t rask_simd_f32x8_mul(int64_t a, int64_t b) {
     float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
     float *r = rask_alloc(8 * sizeof(float));
-    for (int i = 0; i < 8; i++) r[i] = va[i] * vb[i];
+    f32x8_mul_impl(va, vb, r);
     return (int64_t)(uintptr_t)r;
 }
 
 int64_t rask_simd_f32x8_div(int64_t a, int64_t b) {
     float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
     float *r = rask_alloc(8 * sizeof(float));
-    for (int i = 0; i < 8; i++) r[i] = va[i] / vb[i];
+    f32x8_div_impl(va, vb, r);
     return (int64_t)(uintptr_t)r;
 }
 
@@ -166,9 +464,7 @@ int64_t rask_simd_f32x8_scale(int64_t a, double scalar) {
 
 double rask_simd_f32x8_sum(int64_t a) {
     float *va = (float *)(uintptr_t)a;
-    float s = 0;
-    for (int i = 0; i < 8; i++) s += va[i];
-    return (double)s;
+    return f32x8_sum_impl(va);
 }
 
 double rask_simd_f32x8_product(int64_t a) {
@@ -202,6 +498,78 @@ void rask_simd_f32x8_set(int64_t vec, int64_t index, double val) {
     v[index] = (float)val;
 }
 
+int64_t rask_simd_f32x8_fma(int64_t a, int64_t b, int64_t c) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *vc = (float *)(uintptr_t)c;
+    float *r = rask_alloc(8 * sizeof(float));
+    f32x8_fma_impl(va, vb, vc, r);
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x8_min_each(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(8 * sizeof(float));
+    f32x8_min_each_impl(va, vb, r);
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x8_max_each(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(8 * sizeof(float));
+    f32x8_max_each_impl(va, vb, r);
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x8_eq(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(8 * sizeof(float));
+    for (int i = 0; i < 8; i++) r[i] = va[i] == vb[i] ? 1.0f : 0.0f;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x8_ne(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(8 * sizeof(float));
+    for (int i = 0; i < 8; i++) r[i] = va[i] != vb[i] ? 1.0f : 0.0f;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x8_lt(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(8 * sizeof(float));
+    for (int i = 0; i < 8; i++) r[i] = va[i] < vb[i] ? 1.0f : 0.0f;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x8_le(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(8 * sizeof(float));
+    for (int i = 0; i < 8; i++) r[i] = va[i] <= vb[i] ? 1.0f : 0.0f;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x8_gt(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(8 * sizeof(float));
+    for (int i = 0; i < 8; i++) r[i] = va[i] > vb[i] ? 1.0f : 0.0f;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x8_ge(int64_t a, int64_t b) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *r = rask_alloc(8 * sizeof(float));
+    for (int i = 0; i < 8; i++) r[i] = va[i] >= vb[i] ? 1.0f : 0.0f;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f32x8_blend(int64_t a, int64_t b, int64_t mask) {
+    float *va = (float *)(uintptr_t)a, *vb = (float *)(uintptr_t)b;
+    float *vm = (float *)(uintptr_t)mask;
+    float *r = rask_alloc(8 * sizeof(float));
+    for (int i = 0; i < 8; i++) r[i] = vm[i] != 0.0f ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
 // ═══════════════════════════════════════════════════════════
 // f64x2 — 2-lane double-precision float vector
 // ═══════════════════════════════════════════════════════════
@@ -295,6 +663,78 @@ void rask_simd_f64x2_set(int64_t vec, int64_t index, double val) {
     v[index] = val;
 }
 
+int64_t rask_simd_f64x2_fma(int64_t a, int64_t b, int64_t c) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *vc = (double *)(uintptr_t)c;
+    double *r = rask_alloc(2 * sizeof(double));
+    for (int i = 0; i < 2; i++) r[i] = fma(va[i], vb[i], vc[i]);
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x2_min_each(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(2 * sizeof(double));
+    for (int i = 0; i < 2; i++) r[i] = va[i] < vb[i] ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x2_max_each(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(2 * sizeof(double));
+    for (int i = 0; i < 2; i++) r[i] = va[i] > vb[i] ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x2_eq(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(2 * sizeof(double));
+    for (int i = 0; i < 2; i++) r[i] = va[i] == vb[i] ? 1.0 : 0.0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x2_ne(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(2 * sizeof(double));
+    for (int i = 0; i < 2; i++) r[i] = va[i] != vb[i] ? 1.0 : 0.0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x2_lt(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(2 * sizeof(double));
+    for (int i = 0; i < 2; i++) r[i] = va[i] < vb[i] ? 1.0 : 0.0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x2_le(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(2 * sizeof(double));
+    for (int i = 0; i < 2; i++) r[i] = va[i] <= vb[i] ? 1.0 : 0.0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x2_gt(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(2 * sizeof(double));
+    for (int i = 0; i < 2; i++) r[i] = va[i] > vb[i] ? 1.0 : 0.0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x2_ge(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(2 * sizeof(double));
+    for (int i = 0; i < 2; i++) r[i] = va[i] >= vb[i] ? 1.0 : 0.0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x2_blend(int64_t a, int64_t b, int64_t mask) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *vm = (double *)(uintptr_t)mask;
+    double *r = rask_alloc(2 * sizeof(double));
+    for (int i = 0; i < 2; i++) r[i] = vm[i] != 0.0 ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
 // ═══════════════════════════════════════════════════════════
 // f64x4 — 4-lane double-precision float vector
 // ═══════════════════════════════════════════════════════════
@@ -318,28 +758,28 @@ void rask_simd_f64x4_store(int64_t vec, int64_t dst) {
 int64_t rask_simd_f64x4_add(int64_t a, int64_t b) {
     double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
     double *r = rask_alloc(4 * sizeof(double));
-    for (int i = 0; i < 4; i++) r[i] = va[i] + vb[i];
+    f64x4_add_impl(va, vb, r);
     return (int64_t)(uintptr_t)r;
 }
 
 int64_t rask_simd_f64x4_sub(int64_t a, int64_t b) {
     double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
     double *r = rask_alloc(4 * sizeof(double));
-    for (int i = 0; i < 4; i++) r[i] = va[i] - vb[i];
+    f64x4_sub_impl(va, vb, r);
     return (int64_t)(uintptr_t)r;
 }
 
 int64_t rask_simd_f64x4_mul(int64_t a, int64_t b) {
     double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
     double *r = rask_alloc(4 * sizeof(double));
-    for (int i = 0; i < 4; i++) r[i] = va[i] * vb[i];
+    f64x4_mul_impl(va, vb, r);
     return (int64_t)(uintptr_t)r;
 }
 
 int64_t rask_simd_f64x4_div(int64_t a, int64_t b) {
     double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
     double *r = rask_alloc(4 * sizeof(double));
-    for (int i = 0; i < 4; i++) r[i] = va[i] / vb[i];
+    f64x4_div_impl(va, vb, r);
     return (int64_t)(uintptr_t)r;
 }
 
@@ -352,9 +792,7 @@ int64_t rask_simd_f64x4_scale(int64_t a, double scalar) {
 
 double rask_simd_f64x4_sum(int64_t a) {
     double *va = (double *)(uintptr_t)a;
-    double s = 0;
-    for (int i = 0; i < 4; i++) s += va[i];
-    return s;
+    return f64x4_sum_impl(va);
 }
 
 double rask_simd_f64x4_product(int64_t a) {
@@ -388,15 +826,87 @@ void rask_simd_f64x4_set(int64_t vec, int64_t index, double val) {
     v[index] = val;
 }
 
-// ═══════════════════════════════════════════════════════════
-// i32x4 — 4-lane 32-bit integer vector
-// ═══════════════════════════════════════════════════════════
+int64_t rask_simd_f64x4_fma(int64_t a, int64_t b, int64_t c) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *vc = (double *)(uintptr_t)c;
+    double *r = rask_alloc(4 * sizeof(double));
+    f64x4_fma_impl(va, vb, vc, r);
+    return (int64_t)(uintptr_t)r;
+}
 
-int64_t rask_simd_i32x4_splat(int64_t val) {
-    int32_t *v = rask_alloc(4 * sizeof(int32_t));
-    int32_t iv = (int32_t)val;
-    for (int i = 0; i < 4; i++) v[i] = iv;
-    return (int64_t)(uintptr_t)v;
+int64_t rask_simd_f64x4_min_each(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(4 * sizeof(double));
+    f64x4_min_each_impl(va, vb, r);
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x4_max_each(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(4 * sizeof(double));
+    f64x4_max_each_impl(va, vb, r);
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x4_eq(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(4 * sizeof(double));
+    for (int i = 0; i < 4; i++) r[i] = va[i] == vb[i] ? 1.0 : 0.0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x4_ne(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(4 * sizeof(double));
+    for (int i = 0; i < 4; i++) r[i] = va[i] != vb[i] ? 1.0 : 0.0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x4_lt(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(4 * sizeof(double));
+    for (int i = 0; i < 4; i++) r[i] = va[i] < vb[i] ? 1.0 : 0.0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x4_le(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(4 * sizeof(double));
+    for (int i = 0; i < 4; i++) r[i] = va[i] <= vb[i] ? 1.0 : 0.0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x4_gt(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(4 * sizeof(double));
+    for (int i = 0; i < 4; i++) r[i] = va[i] > vb[i] ? 1.0 : 0.0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x4_ge(int64_t a, int64_t b) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *r = rask_alloc(4 * sizeof(double));
+    for (int i = 0; i < 4; i++) r[i] = va[i] >= vb[i] ? 1.0 : 0.0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_f64x4_blend(int64_t a, int64_t b, int64_t mask) {
+    double *va = (double *)(uintptr_t)a, *vb = (double *)(uintptr_t)b;
+    double *vm = (double *)(uintptr_t)mask;
+    double *r = rask_alloc(4 * sizeof(double));
+    for (int i = 0; i < 4; i++) r[i] = vm[i] != 0.0 ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+// ═══════════════════════════════════════════════════════════
+// i32x4 — 4-lane 32-bit integer vector
+// ═══════════════════════════════════════════════════════════
+
+int64_t rask_simd_i32x4_splat(int64_t val) {
+    int32_t *v = rask_alloc(4 * sizeof(int32_t));
+    int32_t iv = (int32_t)val;
+    for (int i = 0; i < 4; i++) v[i] = iv;
+    return (int64_t)(uintptr_t)v;
 }
 
 int64_t rask_simd_i32x4_load(int64_t src) {
@@ -483,6 +993,107 @@ void rask_simd_i32x4_set(int64_t vec, int64_t index, int64_t val) {
     v[index] = (int32_t)val;
 }
 
+int64_t rask_simd_i32x4_min_each(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(4 * sizeof(int32_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] < vb[i] ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x4_max_each(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(4 * sizeof(int32_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] > vb[i] ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x4_shl(int64_t a, int64_t bits) {
+    int32_t *va = (int32_t *)(uintptr_t)a;
+    int32_t *r = rask_alloc(4 * sizeof(int32_t));
+    int s = (int)(bits & 31); // clamp like the hardware shift
+    for (int i = 0; i < 4; i++) r[i] = va[i] << s;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x4_shr(int64_t a, int64_t bits) {
+    int32_t *va = (int32_t *)(uintptr_t)a;
+    int32_t *r = rask_alloc(4 * sizeof(int32_t));
+    int s = (int)(bits & 31); // clamp like the hardware shift
+    for (int i = 0; i < 4; i++) r[i] = va[i] >> s;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x4_and(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(4 * sizeof(int32_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] & vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x4_or(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(4 * sizeof(int32_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] | vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x4_xor(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(4 * sizeof(int32_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] ^ vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x4_eq(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(4 * sizeof(int32_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] == vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x4_ne(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(4 * sizeof(int32_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] != vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x4_lt(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(4 * sizeof(int32_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] < vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x4_le(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(4 * sizeof(int32_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] <= vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x4_gt(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(4 * sizeof(int32_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] > vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x4_ge(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(4 * sizeof(int32_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] >= vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x4_blend(int64_t a, int64_t b, int64_t mask) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *vm = (int32_t *)(uintptr_t)mask;
+    int32_t *r = rask_alloc(4 * sizeof(int32_t));
+    for (int i = 0; i < 4; i++) r[i] = vm[i] != 0 ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
 // ═══════════════════════════════════════════════════════════
 // i32x8 — 8-lane 32-bit integer vector
 // ═══════════════════════════════════════════════════════════
@@ -577,3 +1188,298 @@ void rask_simd_i32x8_set(int64_t vec, int64_t index, int64_t val) {
     int32_t *v = (int32_t *)(uintptr_t)vec;
     v[index] = (int32_t)val;
 }
+
+int64_t rask_simd_i32x8_min_each(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(8 * sizeof(int32_t));
+    for (int i = 0; i < 8; i++) r[i] = va[i] < vb[i] ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x8_max_each(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(8 * sizeof(int32_t));
+    for (int i = 0; i < 8; i++) r[i] = va[i] > vb[i] ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x8_shl(int64_t a, int64_t bits) {
+    int32_t *va = (int32_t *)(uintptr_t)a;
+    int32_t *r = rask_alloc(8 * sizeof(int32_t));
+    int s = (int)(bits & 31); // clamp like the hardware shift
+    for (int i = 0; i < 8; i++) r[i] = va[i] << s;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x8_shr(int64_t a, int64_t bits) {
+    int32_t *va = (int32_t *)(uintptr_t)a;
+    int32_t *r = rask_alloc(8 * sizeof(int32_t));
+    int s = (int)(bits & 31); // clamp like the hardware shift
+    for (int i = 0; i < 8; i++) r[i] = va[i] >> s;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x8_and(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(8 * sizeof(int32_t));
+    for (int i = 0; i < 8; i++) r[i] = va[i] & vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x8_or(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(8 * sizeof(int32_t));
+    for (int i = 0; i < 8; i++) r[i] = va[i] | vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x8_xor(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(8 * sizeof(int32_t));
+    for (int i = 0; i < 8; i++) r[i] = va[i] ^ vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x8_eq(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(8 * sizeof(int32_t));
+    for (int i = 0; i < 8; i++) r[i] = va[i] == vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x8_ne(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(8 * sizeof(int32_t));
+    for (int i = 0; i < 8; i++) r[i] = va[i] != vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x8_lt(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(8 * sizeof(int32_t));
+    for (int i = 0; i < 8; i++) r[i] = va[i] < vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x8_le(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(8 * sizeof(int32_t));
+    for (int i = 0; i < 8; i++) r[i] = va[i] <= vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x8_gt(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(8 * sizeof(int32_t));
+    for (int i = 0; i < 8; i++) r[i] = va[i] > vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x8_ge(int64_t a, int64_t b) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *r = rask_alloc(8 * sizeof(int32_t));
+    for (int i = 0; i < 8; i++) r[i] = va[i] >= vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i32x8_blend(int64_t a, int64_t b, int64_t mask) {
+    int32_t *va = (int32_t *)(uintptr_t)a, *vb = (int32_t *)(uintptr_t)b;
+    int32_t *vm = (int32_t *)(uintptr_t)mask;
+    int32_t *r = rask_alloc(8 * sizeof(int32_t));
+    for (int i = 0; i < 8; i++) r[i] = vm[i] != 0 ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+// ═══════════════════════════════════════════════════════════
+// i64x4 — 4-lane 64-bit integer vector
+// ═══════════════════════════════════════════════════════════
+
+int64_t rask_simd_i64x4_splat(int64_t val) {
+    int64_t *v = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) v[i] = val;
+    return (int64_t)(uintptr_t)v;
+}
+
+int64_t rask_simd_i64x4_load(int64_t src) {
+    int64_t *v = rask_alloc(4 * sizeof(int64_t));
+    memcpy(v, (void *)(uintptr_t)src, 4 * sizeof(int64_t));
+    return (int64_t)(uintptr_t)v;
+}
+
+void rask_simd_i64x4_store(int64_t vec, int64_t dst) {
+    memcpy((void *)(uintptr_t)dst, (void *)(uintptr_t)vec, 4 * sizeof(int64_t));
+}
+
+int64_t rask_simd_i64x4_add(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] + vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_sub(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] - vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_mul(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] * vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_div(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] / vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_scale(int64_t a, int64_t scalar) {
+    int64_t *va = (int64_t *)(uintptr_t)a;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] * scalar;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_sum(int64_t a) {
+    int64_t *va = (int64_t *)(uintptr_t)a;
+    int64_t s = 0;
+    for (int i = 0; i < 4; i++) s += va[i];
+    return s;
+}
+
+int64_t rask_simd_i64x4_product(int64_t a) {
+    int64_t *va = (int64_t *)(uintptr_t)a;
+    int64_t s = 1;
+    for (int i = 0; i < 4; i++) s *= va[i];
+    return s;
+}
+
+int64_t rask_simd_i64x4_min(int64_t a) {
+    int64_t *va = (int64_t *)(uintptr_t)a;
+    int64_t m = va[0];
+    for (int i = 1; i < 4; i++) if (va[i] < m) m = va[i];
+    return (int64_t)m;
+}
+
+int64_t rask_simd_i64x4_max(int64_t a) {
+    int64_t *va = (int64_t *)(uintptr_t)a;
+    int64_t m = va[0];
+    for (int i = 1; i < 4; i++) if (va[i] > m) m = va[i];
+    return (int64_t)m;
+}
+
+int64_t rask_simd_i64x4_get(int64_t vec, int64_t index) {
+    int64_t *v = (int64_t *)(uintptr_t)vec;
+    return (int64_t)v[index];
+}
+
+void rask_simd_i64x4_set(int64_t vec, int64_t index, int64_t val) {
+    int64_t *v = (int64_t *)(uintptr_t)vec;
+    v[index] = val;
+}
+
+int64_t rask_simd_i64x4_min_each(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] < vb[i] ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_max_each(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] > vb[i] ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_shl(int64_t a, int64_t bits) {
+    int64_t *va = (int64_t *)(uintptr_t)a;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    int s = (int)(bits & 63); // clamp like the hardware shift
+    for (int i = 0; i < 4; i++) r[i] = va[i] << s;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_shr(int64_t a, int64_t bits) {
+    int64_t *va = (int64_t *)(uintptr_t)a;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    int s = (int)(bits & 63); // clamp like the hardware shift
+    for (int i = 0; i < 4; i++) r[i] = va[i] >> s;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_and(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] & vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_or(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] | vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_xor(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] ^ vb[i];
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_eq(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] == vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_ne(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] != vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_lt(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] < vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_le(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] <= vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_gt(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] > vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_ge(int64_t a, int64_t b) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = va[i] >= vb[i] ? 1 : 0;
+    return (int64_t)(uintptr_t)r;
+}
+
+int64_t rask_simd_i64x4_blend(int64_t a, int64_t b, int64_t mask) {
+    int64_t *va = (int64_t *)(uintptr_t)a, *vb = (int64_t *)(uintptr_t)b;
+    int64_t *vm = (int64_t *)(uintptr_t)mask;
+    int64_t *r = rask_alloc(4 * sizeof(int64_t));
+    for (int i = 0; i < 4; i++) r[i] = vm[i] != 0 ? va[i] : vb[i];
+    return (int64_t)(uintptr_t)r;
+}
@@ -9,21 +9,41 @@
 // Heap mode (MSB of byte 15 = 1):
 //   [header_ptr: *u8 (8B)][tagged_len: u64 (8B)]
 //   tagged_len = len | RASK_HEAP_FLAG
-//   Header: { atomic_u32 refcount, u32 capacity, u8 data[] }
+//   Header: { atomic_u32 refcount, u32 capacity, u64 hash, u8 data[] }
 //   Single contiguous allocation. Data null-terminated.
 //
 // Refcounting only applies to heap mode. SSO strings have no refcount.
 // Sentinel refcount (UINT32_MAX) marks static literals — never freed.
+//
+// The hash slot caches the string's map hash (0 = not yet computed) so
+// repeated lookups with the same key hash once, not per lookup. In-place
+// mutation through the builder paths resets it.
+//
+// Slice mode (bit 62 of tagged_len, heap only):
+//   tagged_len = RASK_HEAP_FLAG | RASK_SLICE_FLAG | offset<<31 | len
+//   header_ptr points at the PARENT's header; data lives at
+//   header + RASK_STR_HDR + offset. A slice holds one refcount on the
+//   parent buffer — substr/split/lines return views instead of copies.
+//   Slices are not NUL-terminated; rask_string_ptr detaches them into
+//   an owned copy on demand, builder mutation detaches up front.
+//   Offset and length are 31 bits each; larger inputs fall back to
+//   copying.
 
 #include "rask_runtime.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <dirent.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 #define RASK_HEAP_FLAG   ((uint64_t)1 << 63)
+#define RASK_SLICE_FLAG  ((uint64_t)1 << 62)
+#define RASK_SLICE_MAX   (((uint64_t)1 << 31) - 1)
 #define RASK_RC_SENTINEL UINT32_MAX
 #define RASK_SSO_MAX     15
+#define RASK_STR_HDR     16  // refcount + capacity + cached hash
+#define RASK_CAP_MMAP    UINT32_MAX  // cap marker: buffer is an mmap'd file
 
 // ─── Inline helpers ─────────────────────────────────────────
 
@@ -31,15 +51,29 @@ static inline int str_is_heap(const RaskStr *s) {
     return (s->raw[15] & 0x80) != 0;
 }
 
+static inline int str_is_slice(const RaskStr *s) {
+    return str_is_heap(s) && (s->heap.tagged_len & RASK_SLICE_FLAG) != 0;
+}
+
+static inline int64_t slice_off(const RaskStr *s) {
+    return (int64_t)((s->heap.tagged_len >> 31) & RASK_SLICE_MAX);
+}
+
 static inline int64_t str_len(const RaskStr *s) {
-    if (str_is_heap(s))
+    if (str_is_heap(s)) {
+        if (s->heap.tagged_len & RASK_SLICE_FLAG)
+            return (int64_t)(s->heap.tagged_len & RASK_SLICE_MAX);
         return (int64_t)(s->heap.tagged_len & ~RASK_HEAP_FLAG);
+    }
     return 15 - (int64_t)s->sso.remaining;
 }
 
 static inline const char *str_data(const RaskStr *s) {
-    if (str_is_heap(s))
-        return (const char *)(s->heap.header + 8);
+    if (str_is_heap(s)) {
+        if (s->heap.tagged_len & RASK_SLICE_FLAG)
+            return (const char *)(s->heap.header + RASK_STR_HDR + slice_off(s));
+        return (const char *)(s->heap.header + RASK_STR_HDR);
+    }
     return (const char *)s->sso.data;
 }
 
@@ -52,6 +86,19 @@ static inline uint32_t heap_cap(const RaskStr *s) {
     return *(uint32_t *)(s->heap.header + 4);
 }
 
+static inline uint64_t *heap_hash(const RaskStr *s) {
+    return (uint64_t *)(s->heap.header + 8);
+}
+
+// Allocate a heap header with refcount 1, no cached hash
+static uint8_t *str_alloc_header(int64_t cap) {
+    uint8_t *header = (uint8_t *)rask_alloc(RASK_STR_HDR + cap + 1);
+    *(uint32_t *)header = 1;
+    *(uint32_t *)(header + 4) = (uint32_t)cap;
+    *(uint64_t *)(header + 8) = 0;
+    return header;
+}
+
 // ─── Constructors ───────────────────────────────────────────
 
 static void str_make_sso(RaskStr *out, const char *data, int64_t len) {
@@ -61,13 +108,9 @@ static void str_make_sso(RaskStr *out, const char *data, int64_t len) {
 }
 
 static void str_make_heap(RaskStr *out, const char *data, int64_t len) {
-    int64_t cap = len;
-    // Header: [refcount: u32][capacity: u32][data: u8[cap+1]]
-    uint8_t *header = (uint8_t *)rask_alloc(8 + cap + 1);
-    *(uint32_t *)header = 1;              // refcount = 1
-    *(uint32_t *)(header + 4) = (uint32_t)cap; // capacity
-    if (len > 0) memcpy(header + 8, data, (size_t)len);
-    header[8 + len] = '\0';
+    uint8_t *header = str_alloc_header(len);
+    if (len > 0) memcpy(header + RASK_STR_HDR, data, (size_t)len);
+    header[RASK_STR_HDR + len] = '\0';
     out->heap.header = header;
     out->heap.tagged_len = (uint64_t)len | RASK_HEAP_FLAG;
 }
@@ -79,6 +122,44 @@ static void str_make(RaskStr *out, const char *data, int64_t len) {
         str_make_heap(out, data, len);
 }
 
+// View of s[start .. start+len) sharing the parent buffer (one refcount).
+// Copies instead when the parent is SSO, the result fits SSO (cheaper
+// than rc traffic), or offsets exceed the 31-bit slice encoding.
+static void str_make_view(RaskStr *out, const RaskStr *s, int64_t start, int64_t len) {
+    const char *d = str_data(s);
+    if (len <= RASK_SSO_MAX || !str_is_heap(s)) {
+        str_make(out, d + start, len);
+        return;
+    }
+    // Offset relative to the parent buffer — slicing a slice chains to
+    // the same header
+    int64_t off = (int64_t)(d - (const char *)(s->heap.header + RASK_STR_HDR)) + start;
+    if (off > (int64_t)RASK_SLICE_MAX || len > (int64_t)RASK_SLICE_MAX) {
+        str_make(out, d + start, len);
+        return;
+    }
+    rask_string_clone(s);  // +1 on the shared header (no-op for literals)
+    out->heap.header = s->heap.header;
+    out->heap.tagged_len = RASK_HEAP_FLAG | RASK_SLICE_FLAG
+                         | ((uint64_t)off << 31) | (uint64_t)len;
+}
+
+// Wrap an mmap'd region as an owned string. `base` is the mapping start:
+// one anonymous read-write page (total size in its first word, string
+// header at its end), then the read-only file pages with the data. The
+// last free munmaps the whole region; slices refcount it like any other
+// heap buffer.
+void rask_string_adopt_mapping(RaskStr *out, uint8_t *base, uint64_t total, int64_t len) {
+    long page = sysconf(_SC_PAGESIZE);
+    *(uint64_t *)base = total;
+    uint8_t *header = base + page - RASK_STR_HDR;
+    *(uint32_t *)header = 1;
+    *(uint32_t *)(header + 4) = RASK_CAP_MMAP;
+    *(uint64_t *)(header + 8) = 0;
+    out->heap.header = header;
+    out->heap.tagged_len = (uint64_t)len | RASK_HEAP_FLAG;
+}
+
 void rask_string_new(RaskStr *out) {
     str_make_sso(out, NULL, 0);
 }
@@ -94,6 +175,38 @@ void rask_string_from_bytes(RaskStr *out, const char *data, int64_t len) {
     str_make(out, data, len);
 }
 
+// ─── Chunk buffer support (fs.lines) ────────────────────────
+//
+// A reader fills a heap string chunk-at-a-time and hands out slice
+// views of it. The buffer is a normal heap string so the views keep
+// it alive via the shared refcount.
+
+// Heap string with uninitialized payload; caller fills the bytes and
+// trims with rask_string_set_len. Always heap, even below SSO size.
+char *rask_string_alloc_buffer(RaskStr *out, int64_t cap) {
+    uint8_t *header = str_alloc_header(cap);
+    out->heap.header = header;
+    out->heap.tagged_len = (uint64_t)cap | RASK_HEAP_FLAG;
+    return (char *)(header + RASK_STR_HDR);
+}
+
+// Shrink a heap string to its valid prefix. len must not exceed the
+// allocated capacity; no-op for SSO/slices (they have no spare room).
+void rask_string_set_len(RaskStr *s, int64_t len) {
+    if (!str_is_heap(s) || str_is_slice(s)) return;
+    s->heap.tagged_len = (uint64_t)len | RASK_HEAP_FLAG;
+    *heap_hash(s) = 0;
+}
+
+// 1 when this is the only reference — the buffer can be reused in
+// place. SSO counts as unique; static literals never do.
+int64_t rask_string_is_unique(const RaskStr *s) {
+    if (!str_is_heap(s)) return 1;
+    uint32_t *rc = heap_rc(s);
+    if (*rc == RASK_RC_SENTINEL) return 0;
+    return __atomic_load_n(rc, __ATOMIC_ACQUIRE) == 1;
+}
+
 // ─── RC operations ──────────────────────────────────────────
 
 void rask_string_free(const RaskStr *s) {
@@ -102,7 +215,15 @@ void rask_string_free(const RaskStr *s) {
     if (*rc == RASK_RC_SENTINEL) return;
     if (__atomic_sub_fetch(rc, 1, __ATOMIC_ACQ_REL) == 0) {
         uint32_t cap = heap_cap(s);
-        rask_realloc(s->heap.header, 8 + cap + 1, 0);
+        if (cap == RASK_CAP_MMAP) {
+            // Mapped file — the header sits at the end of an anonymous
+            // page whose first word holds the total mapping size
+            long page = sysconf(_SC_PAGESIZE);
+            uint8_t *base = s->heap.header + RASK_STR_HDR - page;
+            munmap(base, (size_t)*(uint64_t *)base);
+        } else {
+            rask_realloc(s->heap.header, RASK_STR_HDR + cap + 1, 0);
+        }
     }
 }
 
@@ -119,7 +240,30 @@ int64_t rask_string_len(const RaskStr *s) {
     return str_len(s);
 }
 
+// Cached map-hash slot (0 = not computed). NULL for SSO strings (no
+// header) and static literals (header may be read-only).
+uint64_t *rask_string_hash_slot(const RaskStr *s) {
+    if (!str_is_heap(s)) return NULL;
+    if (str_is_slice(s)) return NULL;  // slot belongs to the parent
+    if (*heap_rc(s) == RASK_RC_SENTINEL) return NULL;
+    return heap_hash(s);
+}
+
+// Raw bytes + rask_string_len; NOT guaranteed NUL-terminated (slices).
+const char *rask_string_bytes(const RaskStr *s) {
+    return str_data(s);
+}
+
+// NUL-terminated view for C consumers. A slice that doesn't happen to
+// end at a NUL is detached into its own buffer first (in place — the
+// logical value is unchanged).
 const char *rask_string_ptr(const RaskStr *s) {
+    if (str_is_slice(s) && str_data(s)[str_len(s)] != '\0') {
+        RaskStr copy;
+        str_make(&copy, str_data(s), str_len(s));
+        rask_string_free(s);
+        *(RaskStr *)s = copy;
+    }
     return str_data(s);
 }
 
@@ -191,17 +335,46 @@ int64_t rask_string_char_at(const RaskStr *s, int64_t index) {
     return c;
 }
 
+// Substring search with a two-byte filter: memchr (vectorized in libc)
+// skips to candidate positions of the first needle byte, the last
+// needle byte is checked before paying for the full memcmp. Degenerate
+// needles (e.g. runs of one byte) still verify per candidate, but the
+// scan between candidates is no longer byte-at-a-time.
+static int64_t str_search(const char *h, int64_t hlen, const char *n, int64_t nlen) {
+    if (nlen == 1) {
+        const char *p = (const char *)memchr(h, n[0], (size_t)hlen);
+        return p ? p - h : -1;
+    }
+    const char *end = h + hlen - nlen;  // last valid start
+    char last = n[nlen - 1];
+    const char *p = h;
+    while (p <= end) {
+        p = (const char *)memchr(p, n[0], (size_t)(end - p + 1));
+        if (!p) return -1;
+        if (p[nlen - 1] == last && memcmp(p + 1, n + 1, (size_t)(nlen - 2)) == 0)
+            return p - h;
+        p++;
+    }
+    return -1;
+}
+
+// Backward variant: filter on last byte, then first, before memcmp.
+static int64_t str_rsearch(const char *h, int64_t hlen, const char *n, int64_t nlen) {
+    char first = n[0], last = n[nlen - 1];
+    for (int64_t i = hlen - nlen; i >= 0; i--) {
+        if (h[i + nlen - 1] == last && h[i] == first &&
+            memcmp(h + i, n, (size_t)nlen) == 0)
+            return i;
+    }
+    return -1;
+}
+
 int64_t rask_string_contains(const RaskStr *haystack, const RaskStr *needle) {
     int64_t hlen = str_len(haystack);
     int64_t nlen = str_len(needle);
     if (nlen == 0) return 1;
     if (nlen > hlen) return 0;
-    const char *h = str_data(haystack);
-    const char *n = str_data(needle);
-    for (int64_t i = 0; i <= hlen - nlen; i++) {
-        if (memcmp(h + i, n, (size_t)nlen) == 0) return 1;
-    }
-    return 0;
+    return str_search(str_data(haystack), hlen, str_data(needle), nlen) >= 0;
 }
 
 int64_t rask_string_starts_with(const RaskStr *s, const RaskStr *prefix) {
@@ -225,12 +398,7 @@ int64_t rask_string_find(const RaskStr *haystack, const RaskStr *needle) {
     int64_t nlen = str_len(needle);
     if (nlen == 0) return 0;
     if (nlen > hlen) return -1;
-    const char *h = str_data(haystack);
-    const char *n = str_data(needle);
-    for (int64_t i = 0; i <= hlen - nlen; i++) {
-        if (memcmp(h + i, n, (size_t)nlen) == 0) return i;
-    }
-    return -1;
+    return str_search(str_data(haystack), hlen, str_data(needle), nlen);
 }
 
 int64_t rask_string_rfind(const RaskStr *haystack, const RaskStr *needle) {
@@ -238,22 +406,17 @@ int64_t rask_string_rfind(const RaskStr *haystack, const RaskStr *needle) {
     int64_t nlen = str_len(needle);
     if (nlen == 0) return hlen;
     if (nlen > hlen) return -1;
-    const char *h = str_data(haystack);
-    const char *n = str_data(needle);
-    for (int64_t i = hlen - nlen; i >= 0; i--) {
-        if (memcmp(h + i, n, (size_t)nlen) == 0) return i;
-    }
-    return -1;
+    return str_rsearch(str_data(haystack), hlen, str_data(needle), nlen);
 }
 
 int64_t rask_string_parse_int(const RaskStr *s) {
     if (str_len(s) == 0) return 0;
-    return (int64_t)atoll(str_data(s));
+    return (int64_t)atoll(rask_string_ptr(s));  // ptr: slices need a terminated view
 }
 
 double rask_string_parse_float(const RaskStr *s) {
     if (str_len(s) == 0) return 0.0;
-    return atof(str_data(s));
+    return atof(rask_string_ptr(s));
 }
 
 // ─── String-producing operations (out-param) ────────────────
@@ -270,12 +433,10 @@ void rask_string_concat(RaskStr *out, const RaskStr *a, const RaskStr *b) {
         if (blen > 0) memcpy(out->sso.data + alen, bd, (size_t)blen);
         out->sso.remaining = (uint8_t)(15 - total);
     } else {
-        uint8_t *header = (uint8_t *)rask_alloc(8 + total + 1);
-        *(uint32_t *)header = 1;
-        *(uint32_t *)(header + 4) = (uint32_t)total;
-        if (alen > 0) memcpy(header + 8, ad, (size_t)alen);
-        if (blen > 0) memcpy(header + 8 + alen, bd, (size_t)blen);
-        header[8 + total] = '\0';
+        uint8_t *header = str_alloc_header(total);
+        if (alen > 0) memcpy(header + RASK_STR_HDR, ad, (size_t)alen);
+        if (blen > 0) memcpy(header + RASK_STR_HDR + alen, bd, (size_t)blen);
+        header[RASK_STR_HDR + total] = '\0';
         out->heap.header = header;
         out->heap.tagged_len = (uint64_t)total | RASK_HEAP_FLAG;
     }
@@ -286,7 +447,7 @@ void rask_string_substr(RaskStr *out, const RaskStr *s, int64_t start, int64_t e
     if (start < 0) start = 0;
     if (end > slen) end = slen;
     if (start >= end) { rask_string_new(out); return; }
-    str_make(out, str_data(s) + start, end - start);
+    str_make_view(out, s, start, end - start);
 }
 
 void rask_string_to_lowercase(RaskStr *out, const RaskStr *s) {
@@ -362,12 +523,10 @@ void rask_string_repeat(RaskStr *out, const RaskStr *s, int64_t count) {
             memcpy(out->sso.data + i * slen, d, (size_t)slen);
         out->sso.remaining = (uint8_t)(15 - total);
     } else {
-        uint8_t *header = (uint8_t *)rask_alloc(8 + total + 1);
-        *(uint32_t *)header = 1;
-        *(uint32_t *)(header + 4) = (uint32_t)total;
+        uint8_t *header = str_alloc_header(total);
         for (int64_t i = 0; i < count; i++)
-            memcpy(header + 8 + i * slen, d, (size_t)slen);
-        header[8 + total] = '\0';
+            memcpy(header + RASK_STR_HDR + i * slen, d, (size_t)slen);
+        header[RASK_STR_HDR + total] = '\0';
         out->heap.header = header;
         out->heap.tagged_len = (uint64_t)total | RASK_HEAP_FLAG;
     }
@@ -433,11 +592,12 @@ RaskVec *rask_string_lines(const RaskStr *s) {
     if (slen == 0) return v;
     const char *p = str_data(s);
     const char *end = p + slen;
+    const char *base = p;
     while (p < end) {
         const char *nl = (const char *)memchr(p, '\n', (size_t)(end - p));
         int64_t len = nl ? (int64_t)(nl - p) : (int64_t)(end - p);
         RaskStr line;
-        str_make(&line, p, len);
+        str_make_view(&line, s, p - base, len);
         rask_vec_push(v, &line);
         p = nl ? nl + 1 : end;
     }
@@ -463,17 +623,13 @@ RaskVec *rask_string_split(const RaskStr *s, const RaskStr *sep) {
 
     while (p <= end) {
         const char *found = NULL;
-        if (p < end) {
-            for (const char *q = p; q + sep_len <= end; q++) {
-                if (memcmp(q, sepd, (size_t)sep_len) == 0) {
-                    found = q;
-                    break;
-                }
-            }
+        if (p + sep_len <= end) {
+            int64_t idx = str_search(p, end - p, sepd, sep_len);
+            if (idx >= 0) found = p + idx;
         }
         int64_t chunk = found ? (int64_t)(found - p) : (int64_t)(end - p);
         RaskStr part;
-        str_make(&part, p, chunk);
+        str_make_view(&part, s, p - str_data(s), chunk);
         rask_vec_push(v, &part);
         if (!found) break;
         p = found + sep_len;
@@ -495,7 +651,7 @@ RaskVec *rask_string_split_whitespace(const RaskStr *s) {
         while (p < end && *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r')
             p++;
         RaskStr tok;
-        str_make(&tok, start, p - start);
+        str_make_view(&tok, s, start - str_data(s), p - start);
         rask_vec_push(v, &tok);
     }
     return v;
@@ -523,11 +679,21 @@ static uint8_t *builder_ensure_heap(RaskStr *out, const RaskStr *s) {
         // Promote SSO to heap
         const char *d = str_data(s);
         int64_t cap = len < 8 ? 8 : len;
-        uint8_t *header = (uint8_t *)rask_alloc(8 + cap + 1);
-        *(uint32_t *)header = 1;
-        *(uint32_t *)(header + 4) = (uint32_t)cap;
-        if (len > 0) memcpy(header + 8, d, (size_t)len);
-        header[8 + len] = '\0';
+        uint8_t *header = str_alloc_header(cap);
+        if (len > 0) memcpy(header + RASK_STR_HDR, d, (size_t)len);
+        header[RASK_STR_HDR + len] = '\0';
+        out->heap.header = header;
+        out->heap.tagged_len = (uint64_t)len | RASK_HEAP_FLAG;
+        return header;
+    }
+    if (str_is_slice(s) || heap_cap(s) == RASK_CAP_MMAP) {
+        // Slice or mapped file — detach into an owned buffer before
+        // mutating (mapped pages are read-only)
+        const char *d = str_data(s);
+        uint8_t *header = str_alloc_header(len);
+        if (len > 0) memcpy(header + RASK_STR_HDR, d, (size_t)len);
+        header[RASK_STR_HDR + len] = '\0';
+        rask_string_free(s);  // drops the parent ref, frees parent at 0
         out->heap.header = header;
         out->heap.tagged_len = (uint64_t)len | RASK_HEAP_FLAG;
         return header;
@@ -536,12 +702,9 @@ static uint8_t *builder_ensure_heap(RaskStr *out, const RaskStr *s) {
     if (*rc != 1 && *rc != RASK_RC_SENTINEL) {
         // Shared — detach (COW)
         const char *d = str_data(s);
-        int64_t cap = len;
-        uint8_t *header = (uint8_t *)rask_alloc(8 + cap + 1);
-        *(uint32_t *)header = 1;
-        *(uint32_t *)(header + 4) = (uint32_t)cap;
-        if (len > 0) memcpy(header + 8, d, (size_t)len);
-        header[8 + len] = '\0';
+        uint8_t *header = str_alloc_header(len);
+        if (len > 0) memcpy(header + RASK_STR_HDR, d, (size_t)len);
+        header[RASK_STR_HDR + len] = '\0';
         __atomic_sub_fetch(rc, 1, __ATOMIC_ACQ_REL);
         out->heap.header = header;
         out->heap.tagged_len = (uint64_t)len | RASK_HEAP_FLAG;
@@ -550,12 +713,9 @@ static uint8_t *builder_ensure_heap(RaskStr *out, const RaskStr *s) {
     if (*rc == RASK_RC_SENTINEL) {
         // Literal — create mutable copy
         const char *d = str_data(s);
-        int64_t cap = len;
-        uint8_t *header = (uint8_t *)rask_alloc(8 + cap + 1);
-        *(uint32_t *)header = 1;
-        *(uint32_t *)(header + 4) = (uint32_t)cap;
-        if (len > 0) memcpy(header + 8, d, (size_t)len);
-        header[8 + len] = '\0';
+        uint8_t *header = str_alloc_header(len);
+        if (len > 0) memcpy(header + RASK_STR_HDR, d, (size_t)len);
+        header[RASK_STR_HDR + len] = '\0';
         out->heap.header = header;
         out->heap.tagged_len = (uint64_t)len | RASK_HEAP_FLAG;
         return header;
@@ -574,7 +734,7 @@ static void builder_grow(RaskStr *out, int64_t needed) {
         new_cap *= 2;
     }
     out->heap.header = (uint8_t *)rask_realloc(out->heap.header,
-        8 + cap + 1, 8 + new_cap + 1);
+        RASK_STR_HDR + cap + 1, RASK_STR_HDR + new_cap + 1);
     *(uint32_t *)(out->heap.header + 4) = (uint32_t)new_cap;
 }
 
@@ -582,10 +742,11 @@ void rask_string_push_byte(RaskStr *out, const RaskStr *s, uint8_t byte) {
     builder_ensure_heap(out, s);
     int64_t len = str_len(out);
     builder_grow(out, len + 1);
-    out->heap.header[8 + len] = byte;
+    out->heap.header[RASK_STR_HDR + len] = byte;
     len++;
-    out->heap.header[8 + len] = '\0';
+    out->heap.header[RASK_STR_HDR + len] = '\0';
     out->heap.tagged_len = (uint64_t)len | RASK_HEAP_FLAG;
+    *heap_hash(out) = 0;
 }
 
 void rask_string_push_char(RaskStr *out, const RaskStr *s, int32_t cp) {
@@ -614,10 +775,11 @@ void rask_string_push_char(RaskStr *out, const RaskStr *s, int32_t cp) {
     builder_ensure_heap(out, s);
     int64_t len = str_len(out);
     builder_grow(out, len + n);
-    memcpy(out->heap.header + 8 + len, buf, (size_t)n);
+    memcpy(out->heap.header + RASK_STR_HDR + len, buf, (size_t)n);
     len += n;
-    out->heap.header[8 + len] = '\0';
+    out->heap.header[RASK_STR_HDR + len] = '\0';
     out->heap.tagged_len = (uint64_t)len | RASK_HEAP_FLAG;
+    *heap_hash(out) = 0;
 }
 
 void rask_string_append(RaskStr *out, const RaskStr *s, const RaskStr *other) {
@@ -627,10 +789,11 @@ void rask_string_append(RaskStr *out, const RaskStr *s, const RaskStr *other) {
     builder_ensure_heap(out, s);
     int64_t len = str_len(out);
     builder_grow(out, len + olen);
-    memcpy(out->heap.header + 8 + len, od, (size_t)olen);
+    memcpy(out->heap.header + RASK_STR_HDR + len, od, (size_t)olen);
     len += olen;
-    out->heap.header[8 + len] = '\0';
+    out->heap.header[RASK_STR_HDR + len] = '\0';
     out->heap.tagged_len = (uint64_t)len | RASK_HEAP_FLAG;
+    *heap_hash(out) = 0;
 }
 
 void rask_string_append_cstr(RaskStr *out, const RaskStr *s, const char *cstr) {
@@ -640,10 +803,11 @@ void rask_string_append_cstr(RaskStr *out, const RaskStr *s, const char *cstr) {
     builder_ensure_heap(out, s);
     int64_t len = str_len(out);
     builder_grow(out, len + clen);
-    memcpy(out->heap.header + 8 + len, cstr, (size_t)clen);
+    memcpy(out->heap.header + RASK_STR_HDR + len, cstr, (size_t)clen);
     len += clen;
-    out->heap.header[8 + len] = '\0';
+    out->heap.header[RASK_STR_HDR + len] = '\0';
     out->heap.tagged_len = (uint64_t)len | RASK_HEAP_FLAG;
+    *heap_hash(out) = 0;
 }
 
 void rask_string_push_str(RaskStr *out, const RaskStr *s, const RaskStr *other) {
@@ -683,7 +847,7 @@ void rask_char_to_string(RaskStr *out, int32_t codepoint) {
             str_make_sso(out, d, len);
             // Free the heap allocation
             uint32_t cap = *(uint32_t *)(header + 4);
-            rask_realloc(header, 8 + cap + 1, 0);
+            rask_realloc(header, RASK_STR_HDR + cap + 1, 0);
         }
     }
 }
@@ -16,6 +16,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <pthread.h>
+#include <sched.h>
 
 // ─── Mutex ─────────────────────────────────────────────────
 
@@ -65,15 +66,190 @@ int64_t rask_mutex_try_lock(RaskMutex *m, RaskAccessFn f, void *ctx) {
     return 0;
 }
 
-// ─── Shared (RwLock) ───────────────────────────────────────
+// ─── Shared (read-mostly shared/exclusive lock) ────────────
+//
+// pthread_rwlock_rdlock writes one shared cache line on every read
+// acquisition, which bounces between cores when many workers read the
+// same Shared (config, routing tables). Reads here instead bump a
+// counter in one of SHARED_RD_SLOTS cache-line-padded slots picked per
+// thread, so an uncontended read touches no line any other reader
+// writes. Writers serialize on a mutex, raise writer_pending, spin
+// briefly for the slots to drain, then park on a condvar — read
+// callbacks run arbitrary user code (I/O included), so an unbounded
+// spin could burn a core for the whole read. A reader that sees the
+// flag undoes its bump and parks on the writer's mutex until the
+// write is done; the last reader out signals the parked writer.
+
+// Spin-loop hint, cheaper than sched_yield (same shape as green.c).
+static inline void shared_cpu_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#else
+    sched_yield();
+#endif
+}
+
+#define SHARED_RD_SLOTS 16
+
+typedef struct {
+    _Atomic int64_t count;
+    char            pad[64 - sizeof(_Atomic int64_t)];
+} SharedRdSlot;
 
 struct RaskShared {
-    pthread_rwlock_t lock;
+    pthread_mutex_t  wlock;           // writer exclusion + reader parking
+    pthread_mutex_t  park_lock;       // guards the writer's drain wait
+    pthread_cond_t   drained;         // readers signal the parked writer
+    _Atomic int      writer_pending;
+    _Atomic int      writer_parked;
     void            *data;
     int64_t          data_size;
     _Atomic int64_t  refcount;
+    SharedRdSlot     rd[SHARED_RD_SLOTS];
 };
 
+static _Atomic int  shared_slot_seq;
+static __thread int tl_shared_slot = -1;
+
+static SharedRdSlot *shared_my_slot(RaskShared *s) {
+    if (tl_shared_slot < 0) {
+        tl_shared_slot =
+            atomic_fetch_add(&shared_slot_seq, 1) % SHARED_RD_SLOTS;
+    }
+    return &s->rd[tl_shared_slot];
+}
+
+// Reads this thread currently holds, so a nested read of the same
+// Shared skips the writer_pending park (the outer read already keeps
+// the writer out — parking would deadlock against it). Sized for
+// realistic nesting; past 8 distinct instances the nested entry just
+// loses recursion detection.
+
+#define SHARED_HELD_MAX 8
+
+static __thread struct {
+    RaskShared *s;
+    int         depth;
+} tl_shared_held[SHARED_HELD_MAX];
+
+static int shared_held_depth(RaskShared *s) {
+    for (int i = 0; i < SHARED_HELD_MAX; i++) {
+        if (tl_shared_held[i].s == s) return tl_shared_held[i].depth;
+    }
+    return 0;
+}
+
+static void shared_held_adjust(RaskShared *s, int delta) {
+    for (int i = 0; i < SHARED_HELD_MAX; i++) {
+        if (tl_shared_held[i].s == s) {
+            tl_shared_held[i].depth += delta;
+            if (tl_shared_held[i].depth == 0) tl_shared_held[i].s = NULL;
+            return;
+        }
+    }
+    if (delta > 0) {
+        for (int i = 0; i < SHARED_HELD_MAX; i++) {
+            if (tl_shared_held[i].s == NULL) {
+                tl_shared_held[i].s     = s;
+                tl_shared_held[i].depth = delta;
+                return;
+            }
+        }
+    }
+}
+
+// Reader/writer visibility is the classic store-load pattern: the
+// reader's slot bump and its writer_pending load are both seq_cst, as
+// are the writer's flag store and its slot reads — so either the
+// reader sees the flag or the writer sees the bump.
+
+static void shared_read_enter(RaskShared *s) {
+    SharedRdSlot *slot = shared_my_slot(s);
+    for (;;) {
+        atomic_fetch_add(&slot->count, 1);
+        if (!atomic_load(&s->writer_pending)) break;
+        if (shared_held_depth(s) > 0) break; // outer read pins the writer out
+        atomic_fetch_sub(&slot->count, 1);
+        pthread_mutex_lock(&s->wlock);
+        pthread_mutex_unlock(&s->wlock);
+    }
+    shared_held_adjust(s, 1);
+}
+
+static void shared_read_exit(RaskShared *s) {
+    shared_held_adjust(s, -1);
+    atomic_fetch_sub(&shared_my_slot(s)->count, 1);
+    // Wake a writer that gave up spinning. The lock/unlock pair orders
+    // this reader's decrement against the writer's re-check under
+    // park_lock, so the signal can't land between check and wait.
+    if (atomic_load(&s->writer_parked)) {
+        pthread_mutex_lock(&s->park_lock);
+        pthread_mutex_unlock(&s->park_lock);
+        pthread_cond_broadcast(&s->drained);
+    }
+}
+
+static int shared_read_try_enter(RaskShared *s) {
+    SharedRdSlot *slot = shared_my_slot(s);
+    atomic_fetch_add(&slot->count, 1);
+    if (atomic_load(&s->writer_pending) && shared_held_depth(s) == 0) {
+        atomic_fetch_sub(&slot->count, 1);
+        return 0;
+    }
+    shared_held_adjust(s, 1);
+    return 1;
+}
+
+static int shared_readers_active(RaskShared *s) {
+    for (int i = 0; i < SHARED_RD_SLOTS; i++) {
+        if (atomic_load(&s->rd[i].count) != 0) return 1;
+    }
+    return 0;
+}
+
+static void shared_write_enter(RaskShared *s) {
+    pthread_mutex_lock(&s->wlock);
+    atomic_store(&s->writer_pending, 1);
+
+    // Brief spin first — readers that are just bumping a counter drain
+    // in nanoseconds and the park round trip would dominate.
+    for (int spins = 0; spins < 128; spins++) {
+        if (!shared_readers_active(s)) return;
+        if (spins < 64) shared_cpu_relax();
+        else            sched_yield();
+    }
+
+    // Still busy — a reader is doing real work inside the callback.
+    // Park instead of burning the core for its duration.
+    pthread_mutex_lock(&s->park_lock);
+    atomic_store(&s->writer_parked, 1);
+    while (shared_readers_active(s)) {
+        pthread_cond_wait(&s->drained, &s->park_lock);
+    }
+    atomic_store(&s->writer_parked, 0);
+    pthread_mutex_unlock(&s->park_lock);
+}
+
+static void shared_write_exit(RaskShared *s) {
+    atomic_store(&s->writer_pending, 0);
+    pthread_mutex_unlock(&s->wlock);
+}
+
+static int shared_write_try_enter(RaskShared *s) {
+    if (pthread_mutex_trylock(&s->wlock) != 0) return 0;
+    atomic_store(&s->writer_pending, 1);
+    for (int i = 0; i < SHARED_RD_SLOTS; i++) {
+        if (atomic_load(&s->rd[i].count) != 0) {
+            atomic_store(&s->writer_pending, 0);
+            pthread_mutex_unlock(&s->wlock);
+            return 0;
+        }
+    }
+    return 1;
+}
+
 RaskShared *rask_shared_new(const void *initial_data, int64_t data_size) {
     if (data_size <= 0) {
         rask_panic("Shared data size must be positive");
@@ -81,7 +257,14 @@ RaskShared *rask_shared_new(const void *initial_data, int64_t data_size) {
 
     RaskShared *s = (RaskShared *)rask_alloc(sizeof(RaskShared));
 
-    pthread_rwlock_init(&s->lock, NULL);
+    pthread_mutex_init(&s->wlock, NULL);
+    pthread_mutex_init(&s->park_lock, NULL);
+    pthread_cond_init(&s->drained, NULL);
+    atomic_store(&s->writer_pending, 0);
+    atomic_store(&s->writer_parked, 0);
+    for (int i = 0; i < SHARED_RD_SLOTS; i++) {
+        atomic_store(&s->rd[i].count, 0);
+    }
     s->data_size = data_size;
     s->data = rask_alloc(data_size);
 
@@ -93,38 +276,40 @@ RaskShared *rask_shared_new(const void *initial_data, int64_t data_size) {
 void rask_shared_free(RaskShared *s) {
     if (!s) return;
     if (atomic_fetch_sub(&s->refcount, 1) > 1) return;
-    pthread_rwlock_destroy(&s->lock);
+    pthread_mutex_destroy(&s->wlock);
+    pthread_mutex_destroy(&s->park_lock);
+    pthread_cond_destroy(&s->drained);
     rask_free(s->data);
     rask_free(s);
 }
 
 void rask_shared_read(RaskShared *s, RaskAccessFn f, void *ctx) {
     RASK_CHECK_NONNULL(s, "Shared.read: shared handle is null");
-    pthread_rwlock_rdlock(&s->lock);
+    shared_read_enter(s);
     f(s->data, ctx);
-    pthread_rwlock_unlock(&s->lock);
+    shared_read_exit(s);
 }
 
 void rask_shared_write(RaskShared *s, RaskAccessFn f, void *ctx) {
     RASK_CHECK_NONNULL(s, "Shared.write: shared handle is null");
-    pthread_rwlock_wrlock(&s->lock);
+    shared_write_enter(s);
     f(s->data, ctx);
-    pthread_rwlock_unlock(&s->lock);
+    shared_write_exit(s);
 }
 
 int64_t rask_shared_try_read(RaskShared *s, RaskAccessFn f, void *ctx) {
-    if (pthread_rwlock_tryrdlock(&s->lock) == 0) {
+    if (shared_read_try_enter(s)) {
         f(s->data, ctx);
-        pthread_rwlock_unlock(&s->lock);
+        shared_read_exit(s);
         return 1;
     }
     return 0;
 }
 
 int64_t rask_shared_try_write(RaskShared *s, RaskAccessFn f, void *ctx) {
-    if (pthread_rwlock_trywrlock(&s->lock) == 0) {
+    if (shared_write_try_enter(s)) {
         f(s->data, ctx);
-        pthread_rwlock_unlock(&s->lock);
+        shared_write_exit(s);
         return 1;
     }
     return 0;
@@ -151,10 +336,10 @@ int64_t rask_shared_read_i64(int64_t shared, int64_t closure) {
     RaskClosureFn1 fn = (RaskClosureFn1)(intptr_t)CLOSURE_FUNC(closure);
     int64_t env = CLOSURE_ENV(closure);
 
-    pthread_rwlock_rdlock(&s->lock);
+    shared_read_enter(s);
     int64_t data = *(int64_t *)s->data;
     int64_t result = fn(env, data);
-    pthread_rwlock_unlock(&s->lock);
+    shared_read_exit(s);
     return result;
 }
 
@@ -163,11 +348,11 @@ int64_t rask_shared_write_i64(int64_t shared, int64_t closure) {
     RaskClosureFn1 fn = (RaskClosureFn1)(intptr_t)CLOSURE_FUNC(closure);
     int64_t env = CLOSURE_ENV(closure);
 
-    pthread_rwlock_wrlock(&s->lock);
+    shared_write_enter(s);
     int64_t data = *(int64_t *)s->data;
     int64_t new_data = fn(env, data);
     *(int64_t *)s->data = new_data;
-    pthread_rwlock_unlock(&s->lock);
+    shared_write_exit(s);
     return new_data;
 }
 
@@ -237,9 +422,9 @@ int64_t rask_shared_read_ptr(int64_t shared, int64_t closure) {
     RaskClosureFn1 fn = (RaskClosureFn1)(intptr_t)CLOSURE_FUNC(closure);
     int64_t env = CLOSURE_ENV(closure);
 
-    pthread_rwlock_rdlock(&s->lock);
+    shared_read_enter(s);
     int64_t result = fn(env, (int64_t)(intptr_t)s->data);
-    pthread_rwlock_unlock(&s->lock);
+    shared_read_exit(s);
     return result;
 }
 
@@ -248,20 +433,20 @@ int64_t rask_shared_write_ptr(int64_t shared, int64_t closure) {
     RaskClosureFn1 fn = (RaskClosureFn1)(intptr_t)CLOSURE_FUNC(closure);
     int64_t env = CLOSURE_ENV(closure);
 
-    pthread_rwlock_wrlock(&s->lock);
+    shared_write_enter(s);
     int64_t result = fn(env, (int64_t)(intptr_t)s->data);
-    pthread_rwlock_unlock(&s->lock);
+    shared_write_exit(s);
     return result;
 }
 
 // Non-blocking read: returns 1+result on success, 0 if contended (R3)
 int64_t rask_shared_try_read_ptr(int64_t shared, int64_t closure) {
     RaskShared *s = (RaskShared *)(intptr_t)shared;
-    if (pthread_rwlock_tryrdlock(&s->lock) == 0) {
+    if (shared_read_try_enter(s)) {
         RaskClosureFn1 fn = (RaskClosureFn1)(intptr_t)CLOSURE_FUNC(closure);
         int64_t env = CLOSURE_ENV(closure);
         int64_t result = fn(env, (int64_t)(intptr_t)s->data);
-        pthread_rwlock_unlock(&s->lock);
+        shared_read_exit(s);
         // Encode as Option: tag=0 (Some) in high bits, payload in low bits
         // For i64 results, pack as (result << 1) | 1 to distinguish from None(0)
         return (result << 1) | 1;
@@ -272,12 +457,12 @@ int64_t rask_shared_try_read_ptr(int64_t shared, int64_t closure) {
 // Non-blocking write: returns 1+result on success, 0 if contended (R3)
 int64_t rask_shared_try_write_ptr(int64_t shared, int64_t closure) {
     RaskShared *s = (RaskShared *)(intptr_t)shared;
-    if (pthread_rwlock_trywrlock(&s->lock) == 0) {
+    if (shared_write_try_enter(s)) {
         RaskClosureFn1 fn = (RaskClosureFn1)(intptr_t)CLOSURE_FUNC(closure);
         int64_t env = CLOSURE_ENV(closure);
         int64_t result = fn(env, (int64_t)(intptr_t)s->data);
         *(int64_t *)s->data = result;
-        pthread_rwlock_unlock(&s->lock);
+        shared_write_exit(s);
         return (result << 1) | 1;
     }
     return 0; // None
@@ -5,6 +5,11 @@
 #include "rask_runtime.h"
 #include <time.h>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
 static int64_t clock_monotonic_ns(void) {
     struct timespec ts;
     clock_gettime(CLOCK_MONOTONIC, &ts);
@@ -16,6 +21,76 @@ int64_t rask_time_Instant_now(void) {
     return clock_monotonic_ns();
 }
 
+// ─── Fast clock (invariant TSC) ─────────────────────────────
+//
+// rdtsc reads a core register; clock_gettime goes through the vDSO and
+// costs 3-4x more — visible when tracing takes several timestamps per
+// request. Usable only when CPUID reports an invariant TSC (constant
+// rate across P-states, keeps counting in deep sleep); otherwise the
+// fast path silently stays on clock_gettime.
+//
+// Calibration anchors one (monotonic_ns, tsc) pair and a cycles→ns
+// scale measured over a short interval, so fast timestamps share the
+// CLOCK_MONOTONIC epoch and mix with regular Instants. Conversion is
+// one multiply-shift: ns = base_ns + (tsc - base_tsc) * mult >> 32.
+
+#define FAST_CLOCK_UNINIT   0
+#define FAST_CLOCK_TSC      1
+#define FAST_CLOCK_FALLBACK 2
+
+static int      fast_clock_state = FAST_CLOCK_UNINIT;
+static int64_t  fast_base_ns;
+static uint64_t fast_base_tsc;
+static uint64_t fast_mult; // ns per cycle, 32.32 fixed point
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+static int tsc_is_invariant(void) {
+    unsigned eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx)) return 0;
+    return (edx >> 8) & 1; // invariant TSC bit
+}
+#endif
+
+void rask_time_fast_clock_init(void) {
+    if (fast_clock_state != FAST_CLOCK_UNINIT) return;
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    if (tsc_is_invariant()) {
+        // Two-point calibration across ~2ms — enough for a scale error
+        // well under timer resolution at instrumentation timespans.
+        int64_t  ns0  = clock_monotonic_ns();
+        uint64_t tsc0 = __rdtsc();
+        struct timespec pause = { 0, 2000000 };
+        nanosleep(&pause, NULL);
+        int64_t  ns1  = clock_monotonic_ns();
+        uint64_t tsc1 = __rdtsc();
+        if (tsc1 > tsc0 && ns1 > ns0) {
+            fast_mult = (((uint64_t)(ns1 - ns0)) << 32) / (tsc1 - tsc0);
+            fast_base_ns  = ns1;
+            fast_base_tsc = tsc1;
+            fast_clock_state = FAST_CLOCK_TSC;
+            return;
+        }
+    }
+#endif
+    fast_clock_state = FAST_CLOCK_FALLBACK;
+}
+
+int64_t rask_time_Instant_now_fast(void) {
+    if (fast_clock_state == FAST_CLOCK_UNINIT) {
+        // Benign race: concurrent first calls both calibrate and agree
+        // to within the calibration error.
+        rask_time_fast_clock_init();
+    }
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    if (fast_clock_state == FAST_CLOCK_TSC) {
+        uint64_t cycles = __rdtsc() - fast_base_tsc;
+        return fast_base_ns +
+               (int64_t)((unsigned __int128)cycles * fast_mult >> 32);
+    }
+#endif
+    return clock_monotonic_ns();
+}
+
 // instant.elapsed() → Duration (nanoseconds since instant)
 int64_t rask_time_Instant_elapsed(int64_t instant_ns) {
     return clock_monotonic_ns() - instant_ns;
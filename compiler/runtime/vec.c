@@ -86,6 +86,30 @@ int64_t rask_vec_push(RaskVec *v, const void *elem) {
     return 0;
 }
 
+// Bulk append: one grow check, one memcpy for the whole batch.
+// Loops that push element-by-element pay a call + bounds/grow check per
+// element; parsers building multi-million element Vecs should land here.
+int64_t rask_vec_push_many(RaskVec *v, const void *elems, int64_t count) {
+    if (!v) return -1;
+    if (count <= 0) return 0;
+    if (vec_grow(v, rask_safe_add(v->len, count)) != 0) return -1;
+    memcpy(v->data + v->len * v->elem_size, elems,
+           (size_t)rask_safe_mul(count, v->elem_size));
+    v->len += count;
+    return 0;
+}
+
+// extend(v, src) — append all of src's elements to v.
+int64_t rask_vec_extend(RaskVec *v, const RaskVec *src) {
+    if (!v) return -1;
+    if (!src || src->len == 0) return 0;
+    if (v->elem_size != src->elem_size) {
+        rask_panic_fmt("Vec.extend: element size mismatch (%lld vs %lld)",
+                       (long long)v->elem_size, (long long)src->elem_size);
+    }
+    return rask_vec_push_many(v, src->data, src->len);
+}
+
 void *rask_vec_get(const RaskVec *v, int64_t index) {
     if (!v || index < 0 || index >= v->len) {
         rask_panic_fmt("index out of bounds: index %lld, len %lld",
@@ -328,8 +352,59 @@ static int rask_i64_compare(const void *a, const void *b) {
     return 0;
 }
 
+// LSD radix sort for i64 keys: 8 passes of 8 bits, counting + scatter.
+// O(n) instead of qsort's O(n log n) comparison calls. The sign bit is
+// flipped during key extraction so unsigned bucket order matches signed
+// order. Passes where every key shares the same byte are skipped, so
+// small-range data (common: indices, timestamps) pays for 2-3 passes.
+#define VEC_SORT_RADIX_MIN 128
+
+static void vec_sort_radix_i64(RaskVec *v) {
+    int64_t n = v->len;
+    uint64_t *a = (uint64_t *)v->data;
+    uint64_t *tmp = (uint64_t *)rask_alloc(rask_safe_mul(n, 8));
+    uint64_t *src = a, *dst = tmp;
+
+    for (int pass = 0; pass < 8; pass++) {
+        int shift = pass * 8;
+        int64_t count[256] = {0};
+        for (int64_t i = 0; i < n; i++) {
+            count[((src[i] ^ 0x8000000000000000ULL) >> shift) & 0xFF]++;
+        }
+        // All keys in one bucket — pass is a no-op
+        int uniform = 0;
+        for (int b = 0; b < 256; b++) {
+            if (count[b] == n) { uniform = 1; break; }
+            if (count[b] != 0) break;
+        }
+        if (uniform) continue;
+
+        int64_t pos = 0;
+        for (int b = 0; b < 256; b++) {
+            int64_t c = count[b];
+            count[b] = pos;
+            pos += c;
+        }
+        for (int64_t i = 0; i < n; i++) {
+            dst[count[((src[i] ^ 0x8000000000000000ULL) >> shift) & 0xFF]++] = src[i];
+        }
+        uint64_t *swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != a) {
+        memcpy(a, src, (size_t)(n * 8));
+    }
+    rask_realloc(tmp, rask_safe_mul(n, 8), 0);
+}
+
 void rask_vec_sort(RaskVec *v) {
     if (!v || v->len <= 1) return;
+    if (v->elem_size == 8 && v->len >= VEC_SORT_RADIX_MIN) {
+        vec_sort_radix_i64(v);
+        return;
+    }
     qsort(v->data, (size_t)v->len, (size_t)v->elem_size, rask_i64_compare);
 }
 
@@ -425,6 +500,122 @@ RaskVec *rask_iter_skip(const RaskVec *src, int64_t n) {
     return dst;
 }
 
+// ─── Reduction kernels ──────────────────────────────────────
+//
+// Whole-Vec reductions that walk v->data directly — no per-element call
+// or bounds check. Four accumulators keep the loop wide enough for the
+// compiler's vectorizer without assuming -ffast-math: the reassociation
+// is explicit in the accumulator split.
+
+double rask_vec_sum_f64(const RaskVec *v) {
+    if (!v || v->len == 0) return 0.0;
+    const double *d = (const double *)v->data;
+    int64_t n = v->len;
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    int64_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        s0 += d[i];
+        s1 += d[i + 1];
+        s2 += d[i + 2];
+        s3 += d[i + 3];
+    }
+    double s = (s0 + s1) + (s2 + s3);
+    for (; i < n; i++) s += d[i];
+    return s;
+}
+
+double rask_vec_min_f64(const RaskVec *v) {
+    if (!v || v->len == 0) rask_panic("min on empty Vec");
+    const double *d = (const double *)v->data;
+    double m = d[0];
+    for (int64_t i = 1; i < v->len; i++) {
+        if (d[i] < m) m = d[i];
+    }
+    return m;
+}
+
+double rask_vec_max_f64(const RaskVec *v) {
+    if (!v || v->len == 0) rask_panic("max on empty Vec");
+    const double *d = (const double *)v->data;
+    double m = d[0];
+    for (int64_t i = 1; i < v->len; i++) {
+        if (d[i] > m) m = d[i];
+    }
+    return m;
+}
+
+double rask_vec_dot_f64(const RaskVec *a, const RaskVec *b) {
+    if (!a || !b) return 0.0;
+    if (a->len != b->len) {
+        rask_panic_fmt("dot: length mismatch (%lld vs %lld)",
+                       (long long)a->len, (long long)b->len);
+    }
+    const double *da = (const double *)a->data;
+    const double *db = (const double *)b->data;
+    int64_t n = a->len;
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    int64_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        s0 += da[i] * db[i];
+        s1 += da[i + 1] * db[i + 1];
+        s2 += da[i + 2] * db[i + 2];
+        s3 += da[i + 3] * db[i + 3];
+    }
+    double s = (s0 + s1) + (s2 + s3);
+    for (; i < n; i++) s += da[i] * db[i];
+    return s;
+}
+
+int64_t rask_vec_sum_i64(const RaskVec *v) {
+    if (!v || v->len == 0) return 0;
+    const int64_t *d = (const int64_t *)v->data;
+    int64_t n = v->len;
+    int64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    int64_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        s0 += d[i];
+        s1 += d[i + 1];
+        s2 += d[i + 2];
+        s3 += d[i + 3];
+    }
+    int64_t s = s0 + s1 + s2 + s3;
+    for (; i < n; i++) s += d[i];
+    return s;
+}
+
+int64_t rask_vec_min_i64(const RaskVec *v) {
+    if (!v || v->len == 0) rask_panic("min on empty Vec");
+    const int64_t *d = (const int64_t *)v->data;
+    int64_t m = d[0];
+    for (int64_t i = 1; i < v->len; i++) {
+        if (d[i] < m) m = d[i];
+    }
+    return m;
+}
+
+int64_t rask_vec_max_i64(const RaskVec *v) {
+    if (!v || v->len == 0) rask_panic("max on empty Vec");
+    const int64_t *d = (const int64_t *)v->data;
+    int64_t m = d[0];
+    for (int64_t i = 1; i < v->len; i++) {
+        if (d[i] > m) m = d[i];
+    }
+    return m;
+}
+
+int64_t rask_vec_dot_i64(const RaskVec *a, const RaskVec *b) {
+    if (!a || !b) return 0;
+    if (a->len != b->len) {
+        rask_panic_fmt("dot: length mismatch (%lld vs %lld)",
+                       (long long)a->len, (long long)b->len);
+    }
+    const int64_t *da = (const int64_t *)a->data;
+    const int64_t *db = (const int64_t *)b->data;
+    int64_t s = 0;
+    for (int64_t i = 0; i < a->len; i++) s += da[i] * db[i];
+    return s;
+}
+
 // Write Vec data to a FILE*. Used by self-hosted fs.write_bytes.
 void rask_fwrite_vec(int64_t fptr, const RaskVec *v) {
     FILE *f = (FILE *)(uintptr_t)fptr;